@@ -0,0 +1,75 @@
+
+// Copyright (c) 2023 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <nanobench.h>
+
+#include <flux.hpp>
+
+#include <array>
+#include <cstdlib>
+
+namespace an = ankerl::nanobench;
+
+namespace {
+
+auto ints_generator(int n) -> flux::generator<int>
+{
+    for (int i = 0; i < n; i++) {
+        co_yield i;
+    }
+}
+
+// Filling the block in an ordinary function lets the compiler keep the loop
+// state in registers rather than in the coroutine frame
+auto fill_block(std::array<int, 256>& buf, int from, int to) -> std::size_t
+{
+    std::size_t len = 0;
+    for (; len < buf.size() && from < to; ++len) {
+        buf[len] = from++;
+    }
+    return len;
+}
+
+auto ints_batch_generator(int n) -> flux::batch_generator<int>
+{
+    std::array<int, 256> buf;
+    for (int i = 0; i < n; i += static_cast<int>(buf.size())) {
+        co_yield std::span<int const>(buf.data(), fill_block(buf, i, n));
+    }
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    int const n_iters = argc > 1 ? std::atoi(argv[1]) : 20;
+
+    constexpr int n_ints = 10'000'000;
+
+    auto bench = an::Bench().minEpochIterations(n_iters).relative(true);
+
+    bench.run("generator", [&] {
+        long long sum = ints_generator(n_ints)
+                            .map([](int i) { return static_cast<long long>(i); })
+                            .sum();
+        an::doNotOptimizeAway(sum);
+    });
+
+    bench.run("batch_generator", [&] {
+        long long sum = ints_batch_generator(n_ints)
+                            .map([](int i) { return static_cast<long long>(i); })
+                            .sum();
+        an::doNotOptimizeAway(sum);
+    });
+
+    bench.run("raw_loop", [&] {
+        long long sum = 0;
+        for (int i = 0; i < n_ints; i++) {
+            an::doNotOptimizeAway(i);
+            sum += i;
+        }
+        an::doNotOptimizeAway(sum);
+    });
+}
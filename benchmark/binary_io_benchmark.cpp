@@ -0,0 +1,107 @@
+// Copyright (c) 2023 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <nanobench.h>
+
+#include <flux.hpp>
+#include <flux/source/mmap_file.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+namespace an = ankerl::nanobench;
+
+namespace {
+
+struct record {
+    std::int64_t id;
+    double value;
+};
+
+}
+
+int main(int argc, char** argv)
+{
+    int const n_iters = argc > 1 ? std::atoi(argv[1]) : 5;
+
+    constexpr std::int64_t n_records = 16 * 1024 * 1024; // 256MB
+    auto const path = std::filesystem::temp_directory_path() / "flux_binary_io_benchmark.bin";
+
+    std::vector<record> const records = [] {
+        std::vector<record> vec(n_records);
+        for (std::int64_t i = 0; i < n_records; ++i) {
+            vec[i] = record{i, static_cast<double>(i) * 0.5};
+        }
+        return vec;
+    }();
+
+    auto sum_ids = [](auto&& seq) {
+        std::int64_t sum = 0;
+        flux::for_each(FLUX_FWD(seq), [&](record const& r) { sum += r.id; });
+        return sum;
+    };
+    std::int64_t const expected = sum_ids(records);
+
+    auto check = [&](std::int64_t sum) {
+        if (sum != expected) {
+            throw false;
+        }
+    };
+
+    {
+        auto bench = an::Bench().minEpochIterations(n_iters).relative(true);
+
+        // What people write today: one char at a time through a streambuf iterator
+        bench.run("write_output_to_ostreambuf", [&] {
+            std::ofstream out(path, std::ios::binary);
+            flux::output_to(
+                flux::ref(records).map([](record const& r) {
+                    return flux::from_range(std::string_view(
+                        reinterpret_cast<char const*>(&r), sizeof(r)));
+                }).flatten(),
+                std::ostreambuf_iterator<char>(out));
+        });
+
+        bench.run("write_binary_FILE", [&] {
+            std::FILE* file = std::fopen(path.string().c_str(), "wb");
+            flux::write_binary(records, file);
+            std::fclose(file);
+        });
+
+        // A non-contiguous source goes through the internal buffer
+        bench.run("write_binary_FILE_mapped", [&] {
+            std::FILE* file = std::fopen(path.string().c_str(), "wb");
+            flux::write_binary(flux::ref(records).map([](record r) { return r; }), file);
+            std::fclose(file);
+        });
+    }
+
+    {
+        auto bench = an::Bench().minEpochIterations(n_iters).relative(true);
+
+        bench.run("read_istream_read", [&] {
+            std::ifstream in(path, std::ios::binary);
+            std::int64_t sum = 0;
+            record r;
+            while (in.read(reinterpret_cast<char*>(&r), sizeof(r))) {
+                sum += r.id;
+            }
+            check(sum);
+        });
+
+#if FLUX_HAVE_MMAP_FILE
+        bench.run("read_binary_mmap_file", [&] {
+            flux::mmap_file file(path, flux::mmap_advice::sequential);
+            check(sum_ids(flux::read_binary<record>(flux::ref(file))));
+        });
+#endif
+    }
+
+    std::filesystem::remove(path);
+}
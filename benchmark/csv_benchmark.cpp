@@ -0,0 +1,88 @@
+// Copyright (c) 2023 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <nanobench.h>
+
+#include <flux.hpp>
+
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <string_view>
+
+namespace an = ankerl::nanobench;
+
+namespace {
+
+// Ten columns of short fields, with the occasional quoted one
+auto make_csv(std::size_t bytes, int quote_percent) -> std::string
+{
+    std::mt19937 gen{12345};
+    std::uniform_int_distribution<int> len_dist(1, 12);
+    std::uniform_int_distribution<int> pct(0, 99);
+
+    std::string text;
+    text.reserve(bytes + 256);
+    while (text.size() < bytes) {
+        for (int col = 0; col < 10; ++col) {
+            if (col > 0) {
+                text += ',';
+            }
+            if (pct(gen) < quote_percent) {
+                text += '"';
+                text.append(static_cast<std::size_t>(len_dist(gen)), 'q');
+                text += ", \"\"x\"\"\"";
+            } else {
+                text.append(static_cast<std::size_t>(len_dist(gen)), 'f');
+            }
+        }
+        text += '\n';
+    }
+    return text;
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    int const n_iters = argc > 1 ? std::atoi(argv[1]) : 10;
+
+    std::string const unquoted = make_csv(64 * 1024 * 1024, 0);
+    std::string const quoted = make_csv(64 * 1024 * 1024, 5);
+
+    {
+        auto bench = an::Bench().minEpochIterations(n_iters).relative(true);
+
+        // What people hand-roll today; only correct without quoting
+        bench.run("unquoted_lines_split_string", [&] {
+            std::size_t total = 0;
+            flux::for_each(flux::lines(flux::ref(unquoted)), [&](std::string_view line) {
+                flux::for_each(flux::split_string(line, ','), [&](std::string_view field) {
+                    total += field.size();
+                });
+            });
+            an::doNotOptimizeAway(total);
+        });
+
+        bench.run("unquoted_csv", [&] {
+            std::size_t total = 0;
+            flux::for_each(flux::csv(flux::ref(unquoted)), [&](flux::csv_record const& rec) {
+                flux::for_each(rec, [&](std::string_view field) { total += field.size(); });
+            });
+            an::doNotOptimizeAway(total);
+        });
+    }
+
+    {
+        auto bench = an::Bench().minEpochIterations(n_iters).relative(true);
+
+        bench.run("quoted_csv", [&] {
+            std::size_t total = 0;
+            flux::for_each(flux::csv(flux::ref(quoted)), [&](flux::csv_record const& rec) {
+                flux::for_each(rec, [&](std::string_view field) { total += field.size(); });
+            });
+            an::doNotOptimizeAway(total);
+        });
+    }
+}
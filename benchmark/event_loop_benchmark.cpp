@@ -0,0 +1,129 @@
+
+// Copyright (c) 2023 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <nanobench.h>
+
+#include <flux.hpp>
+#include <flux/source/event_loop.hpp>
+
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if FLUX_HAVE_EVENT_LOOP
+
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace an = ankerl::nanobench;
+
+namespace {
+
+constexpr int n_streams = 32;
+constexpr std::size_t bytes_per_stream = 4 * 1024 * 1024;
+
+struct pipe_fds {
+    int read_end;
+    int write_end;
+};
+
+auto make_pipes(bool non_blocking) -> std::vector<pipe_fds>
+{
+    std::vector<pipe_fds> pipes;
+    for (int i = 0; i < n_streams; i++) {
+        int fds[2];
+        if (::pipe(fds) != 0) {
+            std::abort();
+        }
+        if (non_blocking) {
+            ::fcntl(fds[0], F_SETFL, O_NONBLOCK);
+            ::fcntl(fds[1], F_SETFL, O_NONBLOCK);
+        }
+        pipes.push_back({fds[0], fds[1]});
+    }
+    return pipes;
+}
+
+auto count_newlines(flux::array_ptr<char const> chunk) -> std::size_t
+{
+    return static_cast<std::size_t>(flux::count_eq(chunk, '\n'));
+}
+
+auto writer(flux::event_loop& loop, int fd, std::string const& data) -> flux::task<>
+{
+    for (std::size_t written = 0; written < bytes_per_stream; written += data.size()) {
+        co_await loop.write_all(fd, data);
+    }
+    ::close(fd);
+}
+
+auto reader(flux::event_loop& loop, int fd, std::size_t& lines) -> flux::task<>
+{
+    co_await flux::async_for_each(flux::async_read_chunks(loop, fd),
+                                  [&](auto chunk) { lines += count_newlines(chunk); });
+    ::close(fd);
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    int const n_iters = argc > 1 ? std::atoi(argv[1]) : 5;
+
+    std::string const block = [] {
+        std::string str;
+        while (str.size() < 64 * 1024) {
+            str += "the quick brown fox jumps over the lazy dog\n";
+        }
+        return str;
+    }();
+
+    auto bench = an::Bench().minEpochIterations(n_iters).relative(true);
+
+    bench.run("thread_per_stream", [&] {
+        auto pipes = make_pipes(false);
+        std::vector<std::size_t> lines(n_streams);
+        std::vector<std::thread> threads;
+        for (int i = 0; i < n_streams; i++) {
+            threads.emplace_back([&, i] {
+                for (std::size_t n = 0; n < bytes_per_stream; n += block.size()) {
+                    ::write(pipes[i].write_end, block.data(), block.size());
+                }
+                ::close(pipes[i].write_end);
+            });
+            threads.emplace_back([&, i] {
+                auto buf = std::make_unique<char[]>(64 * 1024);
+                while (auto n = ::read(pipes[i].read_end, buf.get(), 64 * 1024)) {
+                    lines[i] += count_newlines(flux::make_array_ptr_unchecked(
+                        static_cast<char const*>(buf.get()), n));
+                }
+                ::close(pipes[i].read_end);
+            });
+        }
+        for (auto& t : threads) {
+            t.join();
+        }
+        an::doNotOptimizeAway(lines);
+    });
+
+    bench.run("single_thread_event_loop", [&] {
+        auto pipes = make_pipes(true);
+        std::vector<std::size_t> lines(n_streams);
+        flux::event_loop loop;
+        for (int i = 0; i < n_streams; i++) {
+            loop.spawn(reader(loop, pipes[i].read_end, lines[i]));
+            loop.spawn(writer(loop, pipes[i].write_end, block));
+        }
+        loop.run();
+        an::doNotOptimizeAway(lines);
+    });
+}
+
+#else
+
+int main() {}
+
+#endif // FLUX_HAVE_EVENT_LOOP
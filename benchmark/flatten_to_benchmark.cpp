@@ -0,0 +1,36 @@
+
+// Copyright (c) 2023 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <nanobench.h>
+
+#include <flux.hpp>
+
+#include <cstdlib>
+#include <vector>
+
+namespace an = ankerl::nanobench;
+
+int main(int argc, char** argv)
+{
+    int const n_iters = argc > 1 ? std::atoi(argv[1]) : 20;
+
+    // 10'000 shards of 1'000 elements each
+    std::vector<std::vector<int>> shards(10'000, std::vector<int>(1'000, 1));
+
+    auto bench = an::Bench().minEpochIterations(n_iters).relative(true);
+
+    // Element by element through the flatten cursor, growing geometrically
+    bench.run("for_each push_back", [&] {
+        std::vector<int> out;
+        flux::ref(shards).flatten().for_each([&out](int i) { out.push_back(i); });
+        an::doNotOptimizeAway(out);
+    });
+
+    // Exact reservation from the size hint, then one copy per shard
+    bench.run("to", [&] {
+        auto out = flux::ref(shards).flatten().to<std::vector<int>>();
+        an::doNotOptimizeAway(out);
+    });
+}
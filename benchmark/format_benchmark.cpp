@@ -0,0 +1,59 @@
+// Copyright (c) 2023 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <nanobench.h>
+
+#include <flux.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <random>
+#include <vector>
+
+#if __has_include(<fcntl.h>) && __has_include(<unistd.h>)
+#include <fcntl.h>
+#include <unistd.h>
+#define HAVE_POSIX_FD 1
+#endif
+
+namespace an = ankerl::nanobench;
+
+int main(int argc, char** argv)
+{
+    int const n_iters = argc > 1 ? std::atoi(argv[1]) : 5;
+
+    constexpr int n_values = 5'000'000;
+
+    std::vector<int> const ints = [] {
+        std::mt19937 gen{12345};
+        std::uniform_int_distribution<int> dist(-1'000'000, 1'000'000);
+        std::vector<int> vec(n_values);
+        for (int& i : vec) {
+            i = dist(gen);
+        }
+        return vec;
+    }();
+
+    auto bench = an::Bench().minEpochIterations(n_iters).relative(true);
+
+    bench.run("ints_ostream", [&] {
+        std::ofstream ofs("/dev/null");
+        flux::write_to(ints, ofs);
+    });
+
+    bench.run("ints_FILE", [&] {
+        std::FILE* file = std::fopen("/dev/null", "w");
+        flux::write_to(ints, file);
+        std::fclose(file);
+    });
+
+#ifdef HAVE_POSIX_FD
+    bench.run("ints_fd", [&] {
+        int fd = ::open("/dev/null", O_WRONLY);
+        flux::write_to(ints, fd);
+        ::close(fd);
+    });
+#endif
+}
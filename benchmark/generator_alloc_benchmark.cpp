@@ -0,0 +1,60 @@
+
+// Copyright (c) 2023 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <nanobench.h>
+
+#include <flux.hpp>
+
+#include <cstddef>
+#include <cstdlib>
+#include <memory>
+
+namespace an = ankerl::nanobench;
+
+namespace {
+
+auto pooled_ints(int n) -> flux::generator<int>
+{
+    for (int i = 0; i < n; i++) {
+        co_yield i;
+    }
+}
+
+// std::allocator goes straight to the global operator new, which is what
+// every generator used before frames were pooled
+auto global_ints(std::allocator_arg_t, std::allocator<std::byte>, int n)
+    -> flux::generator<int>
+{
+    for (int i = 0; i < n; i++) {
+        co_yield i;
+    }
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    int const n_iters = argc > 1 ? std::atoi(argv[1]) : 20;
+
+    constexpr int n_generators = 1'000'000;
+
+    auto bench = an::Bench().minEpochIterations(n_iters).relative(true);
+
+    bench.run("global_new", [&] {
+        long long sum = 0;
+        for (int i = 0; i < n_generators; i++) {
+            sum += global_ints(std::allocator_arg, {}, i % 4).sum();
+        }
+        an::doNotOptimizeAway(sum);
+    });
+
+    bench.run("pooled", [&] {
+        long long sum = 0;
+        for (int i = 0; i < n_generators; i++) {
+            sum += pooled_ints(i % 4).sum();
+        }
+        an::doNotOptimizeAway(sum);
+    });
+}
@@ -0,0 +1,109 @@
+
+// Copyright (c) 2023 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <nanobench.h>
+
+#include <flux.hpp>
+#include <flux/source/mmap_file.hpp>
+#include <flux/source/read_file_chunks.hpp>
+
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <string>
+
+namespace an = ankerl::nanobench;
+
+// Writes a file of roughly `bytes` bytes made up of lines of random length
+static auto make_test_file(std::filesystem::path const& path, std::size_t bytes)
+    -> flux::distance_t
+{
+    std::mt19937 gen{12345};
+    std::uniform_int_distribution<int> len_dist(0, 160);
+
+    std::ofstream out(path, std::ios::binary);
+    std::string line;
+    std::size_t written = 0;
+    flux::distance_t n_lines = 0;
+    while (written < bytes) {
+        line.assign(static_cast<std::size_t>(len_dist(gen)), 'x');
+        line += '\n';
+        out << line;
+        written += line.size();
+        ++n_lines;
+    }
+    return n_lines;
+}
+
+int main(int argc, char** argv)
+{
+    int const n_iters = argc > 1 ? std::atoi(argv[1]) : 10;
+
+    auto const path = std::filesystem::temp_directory_path() / "flux_lines_benchmark.txt";
+    auto const n_lines = make_test_file(path, 256 * 1024 * 1024);
+
+    auto check = [n_lines](flux::distance_t n) {
+        if (n != n_lines) {
+            throw false;
+        }
+    };
+
+    auto bench = an::Bench().minEpochIterations(n_iters).relative(true);
+
+    bench.run("getlines_ifstream", [&] {
+        std::ifstream in(path, std::ios::binary);
+        flux::distance_t total = 0, n = 0;
+        flux::for_each(flux::getlines(in), [&](std::string const& line) {
+            total += static_cast<flux::distance_t>(line.size());
+            ++n;
+        });
+        check(n);
+        an::doNotOptimizeAway(total);
+    });
+
+    bench.run("chunk_records_read_file_chunks", [&] {
+        flux::distance_t total = 0, n = 0;
+        flux::for_each(flux::read_file_chunks(path).chunk_records(),
+                       [&](std::string_view line) {
+            total += static_cast<flux::distance_t>(line.size());
+            ++n;
+        });
+        check(n);
+        an::doNotOptimizeAway(total);
+    });
+
+    // Note that this doesn't include the time to read the file into memory
+    std::string const str = [&] {
+        std::ifstream in(path, std::ios::binary);
+        std::ostringstream oss;
+        oss << in.rdbuf();
+        return std::move(oss).str();
+    }();
+
+    bench.run("lines_in_memory_string", [&] {
+        flux::distance_t total = 0, n = 0;
+        flux::for_each(flux::lines(flux::ref(str)), [&](std::string_view line) {
+            total += static_cast<flux::distance_t>(line.size());
+            ++n;
+        });
+        check(n);
+        an::doNotOptimizeAway(total);
+    });
+
+    bench.run("lines_mmap_file", [&] {
+        flux::mmap_file file(path, flux::mmap_advice::sequential);
+        flux::distance_t total = 0, n = 0;
+        flux::for_each(flux::lines(flux::ref(file)), [&](std::string_view line) {
+            total += static_cast<flux::distance_t>(line.size());
+            ++n;
+        });
+        check(n);
+        an::doNotOptimizeAway(total);
+    });
+
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,46 @@
+
+// Copyright (c) 2023 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <nanobench.h>
+
+#include <flux.hpp>
+
+#include <cstdlib>
+#include <vector>
+
+namespace an = ankerl::nanobench;
+
+int main(int argc, char** argv)
+{
+    int const n_iters = argc > 1 ? std::atoi(argv[1]) : 20;
+
+    std::vector<int> const src(10'000'000, 1);
+    auto scale = [](int i) { return i * 3 + 1; };
+
+    auto bench = an::Bench().minEpochIterations(n_iters).relative(true);
+
+    // Both versions start from a fresh copy of the input, which the pipeline
+    // then consumes
+
+    // Reads through the map adaptor into a second, newly allocated vector
+    bench.run("map to new vector", [&] {
+        auto vec = src;
+        auto out = flux::map(flux::ref(vec), scale).to<std::vector<int>>();
+        an::doNotOptimizeAway(out);
+    });
+
+    // Moves the vector into the pipeline and transforms its buffer in place
+    bench.run("map reusing buffer", [&] {
+        auto vec = src;
+        auto out = flux::from(std::move(vec)).map(scale).to<std::vector<int>>();
+        an::doNotOptimizeAway(out);
+    });
+
+    bench.run("transform_inplace", [&] {
+        auto vec = src;
+        flux::transform_inplace(vec, scale);
+        an::doNotOptimizeAway(vec);
+    });
+}
@@ -9,9 +9,12 @@
 
 #include <flux.hpp>
 
+#include <algorithm>
+#include <array>
 #include <numeric>
 #include <ranges>
 #include <iostream>
+#include <string>
 
 namespace an = ankerl::nanobench;
 
@@ -24,6 +27,16 @@ extern void memset_2d_flux_cartesian_product_iota(double* A, flux::distance_t N,
 extern void memset_diagonal_2d_reference(double* A, flux::distance_t N, flux::distance_t M);
 extern void memset_diagonal_2d_std_cartesian_product_iota_filter(double* A, flux::distance_t N, flux::distance_t M);
 extern void memset_diagonal_2d_flux_cartesian_product_iota_filter(double* A, flux::distance_t N, flux::distance_t M);
+extern void memset_diagonal_2d_flux_cartesian_product_filter(double* A, flux::distance_t N, flux::distance_t M);
+extern void memset_even_rows_2d_reference(double* A, flux::distance_t N, flux::distance_t M);
+extern void memset_even_rows_2d_flux_cartesian_product_iota_filter(double* A, flux::distance_t N, flux::distance_t M);
+extern void memset_even_rows_2d_flux_cartesian_product_filter(double* A, flux::distance_t N, flux::distance_t M);
+extern void memset_3d_reference(double* A, flux::distance_t N, flux::distance_t M, flux::distance_t K);
+extern void memset_3d_std_cartesian_product_iota(double* A, flux::distance_t N, flux::distance_t M, flux::distance_t K);
+extern void memset_3d_flux_cartesian_product_iota(double* A, flux::distance_t N, flux::distance_t M, flux::distance_t K);
+extern void memset_4d_reference(double* A, flux::distance_t N, flux::distance_t M, flux::distance_t K, flux::distance_t L);
+extern void memset_4d_std_cartesian_product_iota(double* A, flux::distance_t N, flux::distance_t M, flux::distance_t K, flux::distance_t L);
+extern void memset_4d_flux_cartesian_product_iota(double* A, flux::distance_t N, flux::distance_t M, flux::distance_t K, flux::distance_t L);
 
 int main(int argc, char** argv)
 {
@@ -63,6 +76,93 @@ int main(int argc, char** argv)
         run_2d_benchmark(memset_2d_flux_cartesian_product_iota);
     }
 
+    // Non-square extents, with the same total number of elements as above
+    for (auto extents : {std::array<flux::distance_t, 2>{16384, 128},
+                         std::array<flux::distance_t, 2>{16, 131072}}) {
+        const auto N_ = extents[0], M_ = extents[1];
+
+        const auto check_2d = [] (auto& A, auto N, auto M) {
+            if (!std::all_of(A.begin(), A.begin() + N * M, [] (auto e) { return e == 0.0; }))
+                throw false;
+        };
+
+        auto bench = an::Bench()
+            .minEpochIterations(n_iters)
+            .relative(true)
+            .performanceCounters(false);
+
+        const auto shape = std::to_string(N_) + "x" + std::to_string(M_);
+
+        const auto run_2d_benchmark_impl = [&] (std::string name, auto func) {
+            run_benchmark(bench, A, N_, M_, name + " " + shape, func, check_2d);
+        };
+
+        run_2d_benchmark(memset_2d_reference);
+        run_2d_benchmark(memset_2d_std_cartesian_product_iota);
+        run_2d_benchmark(memset_2d_flux_cartesian_product_iota);
+    }
+
+    for (auto extents : {std::array<flux::distance_t, 3>{128, 128, 128},
+                         std::array<flux::distance_t, 3>{512, 8, 512},
+                         std::array<flux::distance_t, 3>{16, 1024, 128}}) {
+        const auto N_ = extents[0], M_ = extents[1], K_ = extents[2];
+
+        const auto check_3d = [&] (auto& A) {
+            if (!std::all_of(A.begin(), A.begin() + N_ * M_ * K_, [] (auto e) { return e == 0.0; }))
+                throw false;
+        };
+
+        auto bench = an::Bench()
+            .minEpochIterations(n_iters)
+            .relative(true)
+            .performanceCounters(false);
+
+        const auto shape = std::to_string(N_) + "x" + std::to_string(M_) + "x" + std::to_string(K_);
+
+        const auto run_3d_benchmark_impl = [&] (std::string name, auto func) {
+            std::iota(A.begin(), A.end(), 0);
+            bench.run(name + " " + shape, [&] { func(A.data(), N_, M_, K_); });
+            check_3d(A);
+        };
+
+        #define run_3d_benchmark(func) run_3d_benchmark_impl(#func, func)
+
+        run_3d_benchmark(memset_3d_reference);
+        run_3d_benchmark(memset_3d_std_cartesian_product_iota);
+        run_3d_benchmark(memset_3d_flux_cartesian_product_iota);
+    }
+
+    for (auto extents : {std::array<flux::distance_t, 4>{32, 32, 32, 64},
+                         std::array<flux::distance_t, 4>{2, 4, 2048, 128},
+                         std::array<flux::distance_t, 4>{256, 64, 128, 1}}) {
+        const auto N_ = extents[0], M_ = extents[1], K_ = extents[2], L_ = extents[3];
+
+        const auto check_4d = [&] (auto& A) {
+            if (!std::all_of(A.begin(), A.begin() + N_ * M_ * K_ * L_, [] (auto e) { return e == 0.0; }))
+                throw false;
+        };
+
+        auto bench = an::Bench()
+            .minEpochIterations(n_iters)
+            .relative(true)
+            .performanceCounters(false);
+
+        const auto shape = std::to_string(N_) + "x" + std::to_string(M_) + "x" +
+                           std::to_string(K_) + "x" + std::to_string(L_);
+
+        const auto run_4d_benchmark_impl = [&] (std::string name, auto func) {
+            std::iota(A.begin(), A.end(), 0);
+            bench.run(name + " " + shape, [&] { func(A.data(), N_, M_, K_, L_); });
+            check_4d(A);
+        };
+
+        #define run_4d_benchmark(func) run_4d_benchmark_impl(#func, func)
+
+        run_4d_benchmark(memset_4d_reference);
+        run_4d_benchmark(memset_4d_std_cartesian_product_iota);
+        run_4d_benchmark(memset_4d_flux_cartesian_product_iota);
+    }
+
     {
         const auto check_diagonal_2d = [] (auto& A, auto N, auto M) {
             for (auto i : std::views::iota(0, N))
@@ -89,5 +189,34 @@ int main(int argc, char** argv)
         run_diagonal_2d_benchmark(memset_diagonal_2d_reference);
         run_diagonal_2d_benchmark(memset_diagonal_2d_std_cartesian_product_iota_filter);
         run_diagonal_2d_benchmark(memset_diagonal_2d_flux_cartesian_product_iota_filter);
+        run_diagonal_2d_benchmark(memset_diagonal_2d_flux_cartesian_product_filter);
+    }
+
+    {
+        const auto check_even_rows_2d = [] (auto& A, auto N, auto M) {
+            for (auto i : std::views::iota(0, N))
+                for (auto j : std::views::iota(0, M)) {
+                    if (i % 2 == 0) {
+                        if (A[i * M + j] != 0.0) throw false;
+                    } else {
+                        if (A[i * M + j] != i * M + j) throw false;
+                    }
+                }
+        };
+
+        auto bench = an::Bench()
+            .minEpochIterations(n_iters)
+            .relative(true)
+            .performanceCounters(false);
+
+        const auto run_even_rows_2d_benchmark_impl = [&] (auto name, auto func) {
+            run_benchmark(bench, A, N, M, name, func, check_even_rows_2d);
+        };
+
+        #define run_even_rows_2d_benchmark(func) run_even_rows_2d_benchmark_impl(#func, func)
+
+        run_even_rows_2d_benchmark(memset_even_rows_2d_reference);
+        run_even_rows_2d_benchmark(memset_even_rows_2d_flux_cartesian_product_iota_filter);
+        run_even_rows_2d_benchmark(memset_even_rows_2d_flux_cartesian_product_filter);
     }
 }
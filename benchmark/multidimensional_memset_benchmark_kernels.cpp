@@ -5,6 +5,7 @@
 // file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
 #include <flux/op/cartesian_product.hpp>
+#include <flux/op/cartesian_product_filter.hpp>
 #include <flux/source/iota.hpp>
 #include <flux/op/for_each.hpp>
 #include <flux/op/filter.hpp>
@@ -70,3 +71,100 @@ void memset_diagonal_2d_flux_cartesian_product_iota_filter(double* A, flux::dist
         }));
 }
 
+void memset_diagonal_2d_flux_cartesian_product_filter(double* A, flux::distance_t N, flux::distance_t M)
+{
+    flux::for_each(
+        flux::cartesian_product_filter(
+            std::tuple{[] (auto) { return true; },
+                       [] (auto i, auto j) { return i == j; }},
+            flux::ints(0, N), flux::ints(0, M)),
+        flux::unpack([&] (auto i, auto j) {
+            A[i * M + j] = 0.0;
+        }));
+}
+
+void memset_even_rows_2d_reference(double* A, flux::distance_t N, flux::distance_t M)
+{
+    for (flux::distance_t i = 0; i != N; ++i)
+        if (i % 2 == 0)
+            for (flux::distance_t j = 0; j != M; ++j)
+                A[i * M + j] = 0.0;
+}
+
+void memset_even_rows_2d_flux_cartesian_product_iota_filter(double* A, flux::distance_t N, flux::distance_t M)
+{
+    flux::for_each(
+        flux::cartesian_product(flux::ints(0, N), flux::ints(0, M))
+            .filter(flux::unpack([] (auto i, auto) { return i % 2 == 0; })),
+        flux::unpack([&] (auto i, auto j) {
+            A[i * M + j] = 0.0;
+        }));
+}
+
+void memset_even_rows_2d_flux_cartesian_product_filter(double* A, flux::distance_t N, flux::distance_t M)
+{
+    flux::for_each(
+        flux::cartesian_product_filter(
+            std::tuple{[] (auto i) { return i % 2 == 0; },
+                       [] (auto, auto) { return true; }},
+            flux::ints(0, N), flux::ints(0, M)),
+        flux::unpack([&] (auto i, auto j) {
+            A[i * M + j] = 0.0;
+        }));
+}
+
+
+void memset_3d_reference(double* A, flux::distance_t N, flux::distance_t M, flux::distance_t K)
+{
+    for (flux::distance_t i = 0; i != N; ++i)
+        for (flux::distance_t j = 0; j != M; ++j)
+            for (flux::distance_t k = 0; k != K; ++k)
+                A[(i * M + j) * K + k] = 0.0;
+}
+
+void memset_3d_std_cartesian_product_iota(double* A, flux::distance_t N, flux::distance_t M, flux::distance_t K)
+{
+    std::ranges::for_each(
+        std::views::cartesian_product(std::views::iota(0, N), std::views::iota(0, M),
+                                      std::views::iota(0, K)),
+        flux::unpack([&] (auto i, auto j, auto k) {
+            A[(i * M + j) * K + k] = 0.0;
+        }));
+}
+
+void memset_3d_flux_cartesian_product_iota(double* A, flux::distance_t N, flux::distance_t M, flux::distance_t K)
+{
+    flux::for_each(
+        flux::cartesian_product(flux::ints(0, N), flux::ints(0, M), flux::ints(0, K)),
+        flux::unpack([&] (auto i, auto j, auto k) {
+            A[(i * M + j) * K + k] = 0.0;
+        }));
+}
+
+void memset_4d_reference(double* A, flux::distance_t N, flux::distance_t M, flux::distance_t K, flux::distance_t L)
+{
+    for (flux::distance_t i = 0; i != N; ++i)
+        for (flux::distance_t j = 0; j != M; ++j)
+            for (flux::distance_t k = 0; k != K; ++k)
+                for (flux::distance_t l = 0; l != L; ++l)
+                    A[((i * M + j) * K + k) * L + l] = 0.0;
+}
+
+void memset_4d_std_cartesian_product_iota(double* A, flux::distance_t N, flux::distance_t M, flux::distance_t K, flux::distance_t L)
+{
+    std::ranges::for_each(
+        std::views::cartesian_product(std::views::iota(0, N), std::views::iota(0, M),
+                                      std::views::iota(0, K), std::views::iota(0, L)),
+        flux::unpack([&] (auto i, auto j, auto k, auto l) {
+            A[((i * M + j) * K + k) * L + l] = 0.0;
+        }));
+}
+
+void memset_4d_flux_cartesian_product_iota(double* A, flux::distance_t N, flux::distance_t M, flux::distance_t K, flux::distance_t L)
+{
+    flux::for_each(
+        flux::cartesian_product(flux::ints(0, N), flux::ints(0, M), flux::ints(0, K), flux::ints(0, L)),
+        flux::unpack([&] (auto i, auto j, auto k, auto l) {
+            A[((i * M + j) * K + k) * L + l] = 0.0;
+        }));
+}
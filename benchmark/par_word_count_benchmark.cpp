@@ -0,0 +1,105 @@
+// Copyright (c) 2023 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// A parallel version of example/word_count.cpp
+
+#include <nanobench.h>
+
+#include <flux.hpp>
+#include <flux/op/par_text_chunks.hpp>
+
+#include <cctype>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <string_view>
+
+namespace an = ankerl::nanobench;
+
+namespace {
+
+struct stats_t {
+    std::size_t lines = 0;
+    std::size_t words = 0;
+    std::size_t chars = 0;
+
+    friend auto operator+(stats_t lhs, stats_t rhs) -> stats_t
+    {
+        return {lhs.lines + rhs.lines, lhs.words + rhs.words, lhs.chars + rhs.chars};
+    }
+};
+
+// The same counting logic as the word_count example
+auto collect_stats(std::string_view text) -> stats_t
+{
+    stats_t stats;
+    bool is_last_space = true;
+    flux::for_each(text, [&](char c) {
+        bool const is_space = std::isspace(static_cast<unsigned char>(c));
+        stats.chars++;
+        if (!is_last_space && is_space) {
+            stats.words++;
+        }
+        if (c == '\n') {
+            stats.lines++;
+        }
+        is_last_space = is_space;
+    });
+    if (!is_last_space) {
+        stats.words++;
+    }
+    return stats;
+}
+
+auto make_text(std::size_t bytes) -> std::string
+{
+    std::mt19937 gen{12345};
+    std::uniform_int_distribution<int> word_len(1, 12);
+    std::uniform_int_distribution<int> words_per_line(0, 15);
+
+    std::string text;
+    text.reserve(bytes + 256);
+    while (text.size() < bytes) {
+        int n_words = words_per_line(gen);
+        for (int i = 0; i < n_words; ++i) {
+            text.append(static_cast<std::size_t>(word_len(gen)), 'w');
+            text += ' ';
+        }
+        text += '\n';
+    }
+    return text;
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    int const n_iters = argc > 1 ? std::atoi(argv[1]) : 10;
+
+    std::string const text = make_text(256 * 1024 * 1024);
+    stats_t const expected = collect_stats(text);
+
+    auto check = [&](stats_t const& s) {
+        if (s.lines != expected.lines || s.words != expected.words ||
+            s.chars != expected.chars) {
+            throw false;
+        }
+    };
+
+    auto bench = an::Bench().minEpochIterations(n_iters).relative(true);
+
+    bench.run("word_count_serial", [&] {
+        auto stats = collect_stats(text);
+        check(stats);
+        an::doNotOptimizeAway(stats);
+    });
+
+    // Chunks always end with a newline, so no word can be split between two
+    // of them and the per-chunk counts can simply be added
+    bench.run("word_count_par_text_chunks", [&] {
+        auto stats = flux::par_text_chunks(flux::ref(text), '\n', collect_stats, std::plus<>{});
+        check(stats);
+        an::doNotOptimizeAway(stats);
+    });
+}
@@ -0,0 +1,83 @@
+
+// Copyright (c) 2023 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <nanobench.h>
+
+#include <flux.hpp>
+
+#include <cstdlib>
+#include <random>
+#include <sstream>
+#include <string>
+
+namespace an = ankerl::nanobench;
+
+int main(int argc, char** argv)
+{
+    int const n_iters = argc > 1 ? std::atoi(argv[1]) : 20;
+
+    constexpr int n_values = 5'000'000;
+
+    std::string const ints_text = [] {
+        std::mt19937 gen{12345};
+        std::uniform_int_distribution<int> dist(-1'000'000, 1'000'000);
+        std::string str;
+        for (int i = 0; i < n_values; ++i) {
+            str += std::to_string(dist(gen));
+            str += (i % 10 == 9) ? '\n' : ' ';
+        }
+        return str;
+    }();
+
+#if FLUX_HAVE_FLOAT_FROM_CHARS
+    std::string const doubles_text = [] {
+        std::mt19937 gen{12345};
+        std::uniform_real_distribution<double> dist(-1e6, 1e6);
+        std::ostringstream oss;
+        for (int i = 0; i < n_values; ++i) {
+            oss << dist(gen) << ((i % 10 == 9) ? '\n' : ' ');
+        }
+        return std::move(oss).str();
+    }();
+#endif
+
+    {
+        auto bench = an::Bench().minEpochIterations(n_iters).relative(true);
+
+        bench.run("ints_from_istream", [&] {
+            std::istringstream iss(ints_text);
+            long long sum = flux::from_istream<int>(iss)
+                                .map([](int i) { return static_cast<long long>(i); })
+                                .sum();
+            an::doNotOptimizeAway(sum);
+        });
+
+        bench.run("ints_parse", [&] {
+            long long sum = flux::parse<int>(flux::ref(ints_text))
+                                .map([](auto o) { return static_cast<long long>(o.value()); })
+                                .sum();
+            an::doNotOptimizeAway(sum);
+        });
+    }
+
+#if FLUX_HAVE_FLOAT_FROM_CHARS
+    {
+        auto bench = an::Bench().minEpochIterations(n_iters).relative(true);
+
+        bench.run("doubles_from_istream", [&] {
+            std::istringstream iss(doubles_text);
+            double sum = flux::from_istream<double>(iss).sum();
+            an::doNotOptimizeAway(sum);
+        });
+
+        bench.run("doubles_parse", [&] {
+            double sum = flux::parse<double>(flux::ref(doubles_text))
+                             .map([](auto o) { return o.value(); })
+                             .sum();
+            an::doNotOptimizeAway(sum);
+        });
+    }
+#endif
+}
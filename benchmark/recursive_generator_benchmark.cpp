@@ -0,0 +1,95 @@
+
+// Copyright (c) 2023 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <nanobench.h>
+
+#include <flux.hpp>
+
+#include <cstdlib>
+
+namespace an = ankerl::nanobench;
+
+namespace {
+
+// Yields [lo, hi) by recursively splitting the range in half
+auto tree_reyield(int lo, int hi) -> flux::generator<int>
+{
+    if (hi - lo == 1) {
+        co_yield lo;
+    } else {
+        int mid = lo + (hi - lo) / 2;
+        for (int i : tree_reyield(lo, mid)) {
+            co_yield i;
+        }
+        for (int i : tree_reyield(mid, hi)) {
+            co_yield i;
+        }
+    }
+}
+
+auto tree_elements_of(int lo, int hi) -> flux::generator<int>
+{
+    if (hi - lo == 1) {
+        co_yield lo;
+    } else {
+        int mid = lo + (hi - lo) / 2;
+        co_yield flux::elements_of(tree_elements_of(lo, mid));
+        co_yield flux::elements_of(tree_elements_of(mid, hi));
+    }
+}
+
+// A degenerate tree: each level yields one element and then nests
+auto chain_reyield(int n) -> flux::generator<int>
+{
+    co_yield n;
+    if (n > 0) {
+        for (int i : chain_reyield(n - 1)) {
+            co_yield i;
+        }
+    }
+}
+
+auto chain_elements_of(int n) -> flux::generator<int>
+{
+    co_yield n;
+    if (n > 0) {
+        co_yield flux::elements_of(chain_elements_of(n - 1));
+    }
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    int const n_iters = argc > 1 ? std::atoi(argv[1]) : 10;
+
+    {
+        constexpr int n_leaves = 1 << 20;
+
+        auto bench = an::Bench().minEpochIterations(n_iters).relative(true);
+
+        bench.run("balanced_tree_reyield", [&] {
+            an::doNotOptimizeAway(tree_reyield(0, n_leaves).sum());
+        });
+
+        bench.run("balanced_tree_elements_of", [&] {
+            an::doNotOptimizeAway(tree_elements_of(0, n_leaves).sum());
+        });
+    }
+
+    {
+        constexpr int depth = 2000;
+
+        auto bench = an::Bench().minEpochIterations(n_iters).relative(true);
+
+        bench.run("chain_reyield", [&] {
+            an::doNotOptimizeAway(chain_reyield(depth).sum());
+        });
+
+        bench.run("chain_elements_of", [&] {
+            an::doNotOptimizeAway(chain_elements_of(depth).sum());
+        });
+    }
+}
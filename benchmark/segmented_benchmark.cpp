@@ -0,0 +1,75 @@
+
+// Copyright (c) 2023 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <nanobench.h>
+
+#include <flux.hpp>
+#include <flux/source/deque.hpp>
+
+#include <cstdlib>
+#include <deque>
+#include <random>
+#include <vector>
+
+namespace an = ankerl::nanobench;
+
+int main(int argc, char** argv)
+{
+    int const n_iters = argc > 1 ? std::atoi(argv[1]) : 20;
+
+    constexpr int sz = 10'000'000;
+
+    std::deque<char> chars(sz, 'a');
+    chars.back() = 'b';
+
+    std::deque<int> ints(sz);
+    std::mt19937 gen{};
+    std::uniform_int_distribution<int> dist(0, 1'000'000);
+    for (auto& i : ints) {
+        i = dist(gen);
+    }
+
+    // from_range() sees the deque as a plain random-access range, one
+    // element at a time; the deque's own traits work block by block
+    {
+        auto bench = an::Bench().minEpochIterations(n_iters).relative(true);
+
+        bench.run("find (from_range)", [&] {
+            an::doNotOptimizeAway(flux::find(flux::from_range(chars), 'b'));
+        });
+
+        bench.run("find (segmented)", [&] {
+            an::doNotOptimizeAway(flux::find(chars, 'b'));
+        });
+    }
+
+    {
+        auto bench = an::Bench().minEpochIterations(n_iters).relative(true);
+
+        bench.run("sum (from_range)", [&] {
+            an::doNotOptimizeAway(flux::sum(flux::from_range(ints)));
+        });
+
+        bench.run("sum (segmented)", [&] {
+            an::doNotOptimizeAway(flux::sum(ints));
+        });
+    }
+
+    {
+        auto bench = an::Bench().minEpochIterations(1).relative(true);
+
+        bench.run("sort (from_range)", [&] {
+            auto copy = ints;
+            flux::sort(flux::from_range(copy));
+            an::doNotOptimizeAway(copy);
+        });
+
+        bench.run("sort (segmented)", [&] {
+            auto copy = ints;
+            flux::sort(copy);
+            an::doNotOptimizeAway(copy);
+        });
+    }
+}
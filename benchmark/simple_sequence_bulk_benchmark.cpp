@@ -0,0 +1,136 @@
+
+// Copyright (c) 2023 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <nanobench.h>
+
+#include <flux.hpp>
+
+#include <cstdint>
+#include <cstdlib>
+#include <optional>
+#include <random>
+#include <span>
+#include <vector>
+
+namespace an = ankerl::nanobench;
+
+namespace {
+
+// Decodes 12-bit values, packed in pairs into three bytes
+struct unpacker_base {
+    std::uint8_t const* pos_;
+    std::size_t remaining_;
+    bool second_ = false;
+
+    auto next_value() -> std::uint32_t
+    {
+        std::uint32_t word = pos_[0] | (pos_[1] << 8) | (pos_[2] << 16);
+        --remaining_;
+        if (second_) {
+            pos_ += 3;
+            second_ = false;
+            return word >> 12;
+        } else {
+            second_ = true;
+            return word & 0xfff;
+        }
+    }
+};
+
+struct unpacker : unpacker_base, flux::simple_sequence_base<unpacker> {
+    unpacker(std::vector<std::uint8_t> const& bytes, std::size_t count)
+        : unpacker_base{bytes.data(), count}
+    {}
+
+    auto maybe_next() -> std::optional<std::uint32_t>
+    {
+        if (remaining_ == 0) {
+            return std::nullopt;
+        }
+        return next_value();
+    }
+};
+
+struct bulk_unpacker : unpacker_base, flux::simple_sequence_base<bulk_unpacker> {
+    bulk_unpacker(std::vector<std::uint8_t> const& bytes, std::size_t count)
+        : unpacker_base{bytes.data(), count}
+    {}
+
+    auto maybe_next() -> std::optional<std::uint32_t>
+    {
+        if (remaining_ == 0) {
+            return std::nullopt;
+        }
+        return next_value();
+    }
+
+    // Decodes whole pairs at a time, falling back to single values at the
+    // edges
+    auto maybe_next_n(std::span<std::uint32_t> out) -> std::size_t
+    {
+        if (second_ || remaining_ < 2 || out.size() < 2) {
+            if (remaining_ == 0) {
+                return 0;
+            }
+            out[0] = next_value();
+            return 1;
+        }
+
+        std::size_t const pairs = (out.size() < remaining_ ? out.size() : remaining_) / 2;
+        std::uint8_t const* pos = pos_;
+        for (std::size_t i = 0; i < pairs; ++i, pos += 3) {
+            std::uint32_t word = pos[0] | (pos[1] << 8) | (pos[2] << 16);
+            out[2 * i] = word & 0xfff;
+            out[2 * i + 1] = word >> 12;
+        }
+        pos_ = pos;
+        remaining_ -= 2 * pairs;
+        return 2 * pairs;
+    }
+};
+
+}
+
+int main(int argc, char** argv)
+{
+    int const n_iters = argc > 1 ? std::atoi(argv[1]) : 20;
+
+    constexpr std::size_t n_values = 20'000'000;
+
+    std::vector<std::uint8_t> const bytes = [] {
+        std::mt19937 gen{12345};
+        std::vector<std::uint8_t> out(n_values / 2 * 3);
+        for (auto& b : out) {
+            b = static_cast<std::uint8_t>(gen());
+        }
+        return out;
+    }();
+
+    auto widen = [](std::uint32_t i) { return std::uint64_t{i}; };
+
+    {
+        auto bench = an::Bench().minEpochIterations(n_iters).relative(true);
+
+        bench.run("sum_maybe_next", [&] {
+            an::doNotOptimizeAway(unpacker(bytes, n_values).map(widen).sum());
+        });
+
+        bench.run("sum_maybe_next_n", [&] {
+            an::doNotOptimizeAway(bulk_unpacker(bytes, n_values).map(widen).sum());
+        });
+    }
+
+    {
+        auto bench = an::Bench().minEpochIterations(n_iters).relative(true);
+
+        bench.run("to_vector_maybe_next", [&] {
+            an::doNotOptimizeAway(unpacker(bytes, n_values).to<std::vector<std::uint32_t>>());
+        });
+
+        bench.run("to_vector_maybe_next_n", [&] {
+            an::doNotOptimizeAway(bulk_unpacker(bytes, n_values).to<std::vector<std::uint32_t>>());
+        });
+    }
+}
@@ -0,0 +1,46 @@
+
+// Copyright (c) 2023 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <nanobench.h>
+
+#include <flux.hpp>
+
+#include <cstdlib>
+#include <numeric>
+#include <vector>
+
+namespace an = ankerl::nanobench;
+
+int main(int argc, char** argv)
+{
+    int const n_iters = argc > 1 ? std::atoi(argv[1]) : 20;
+
+    std::vector<int> ints(10'000'000);
+    std::iota(ints.begin(), ints.end(), 0);
+
+    auto keep = [](int i) { return i % 8 != 0; };
+
+    auto bench = an::Bench().minEpochIterations(n_iters).relative(true);
+
+    // Growing geometrically, as to() used to do for single-pass sequences
+    bench.run("push_back", [&] {
+        std::vector<int> out;
+        flux::ref(ints).filter(keep).for_each([&out](int i) { out.push_back(i); });
+        an::doNotOptimizeAway(out);
+    });
+
+    // Walking the sequence twice, as to() used to do for multipass sequences
+    bench.run("iterator pair", [&] {
+        auto seq = flux::ref(ints).filter(keep);
+        auto out = std::vector<int>(seq.begin(), seq.end());
+        an::doNotOptimizeAway(out);
+    });
+
+    // Reserving once from the size hint
+    bench.run("to (size_hint)", [&] {
+        auto out = flux::ref(ints).filter(keep).to<std::vector<int>>();
+        an::doNotOptimizeAway(out);
+    });
+}
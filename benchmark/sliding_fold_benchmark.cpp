@@ -0,0 +1,67 @@
+
+// Copyright (c) 2023 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <nanobench.h>
+
+#include <flux.hpp>
+
+#include <cstdlib>
+#include <functional>
+#include <random>
+#include <vector>
+
+namespace an = ankerl::nanobench;
+
+int main(int argc, char** argv)
+{
+    int const n_iters = argc > 1 ? std::atoi(argv[1]) : 5;
+
+    constexpr int win_sz = 1'000;
+
+    std::vector<int> vec(200'000);
+    std::mt19937 gen{};
+    std::uniform_int_distribution<int> dist(-1000, 1000);
+    for (auto& i : vec) {
+        i = dist(gen);
+    }
+
+    // slide() hands out each window as a subsequence, which is then
+    // processed in full, so these are O(n * win_sz)
+    {
+        auto bench = an::Bench().minEpochIterations(n_iters).relative(true);
+
+        bench.run("slide + sum", [&] {
+            auto out = flux::ref(vec)
+                           .slide(win_sz)
+                           .map([](auto win) { return win.sum(); })
+                           .to<std::vector<int>>();
+            an::doNotOptimizeAway(out);
+        });
+
+        bench.run("sliding_fold", [&] {
+            auto out = flux::ref(vec)
+                           .sliding_fold(win_sz, std::plus<>{}, std::minus<>{})
+                           .to<std::vector<int>>();
+            an::doNotOptimizeAway(out);
+        });
+    }
+
+    {
+        auto bench = an::Bench().minEpochIterations(n_iters).relative(true);
+
+        bench.run("slide + min", [&] {
+            auto out = flux::ref(vec)
+                           .slide(win_sz)
+                           .map([](auto win) { return win.min().value(); })
+                           .to<std::vector<int>>();
+            an::doNotOptimizeAway(out);
+        });
+
+        bench.run("sliding_min", [&] {
+            auto out = flux::ref(vec).sliding_min(win_sz).to<std::vector<int>>();
+            an::doNotOptimizeAway(out);
+        });
+    }
+}
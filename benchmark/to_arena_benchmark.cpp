@@ -0,0 +1,39 @@
+
+// Copyright (c) 2023 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <nanobench.h>
+
+#include <flux.hpp>
+
+#include <cstdlib>
+#include <memory_resource>
+#include <numeric>
+#include <vector>
+
+namespace an = ankerl::nanobench;
+
+int main(int argc, char** argv)
+{
+    int const n_iters = argc > 1 ? std::atoi(argv[1]) : 20;
+
+    std::vector<int> ints(3'000'000);
+    std::iota(ints.begin(), ints.end(), 0);
+
+    auto bench = an::Bench().minEpochIterations(n_iters).relative(true);
+
+    // One allocation per group
+    bench.run("nested std::vector", [&] {
+        auto groups = flux::to<std::vector<std::vector<int>>>(flux::chunk(flux::ref(ints), 3));
+        an::doNotOptimizeAway(groups);
+    });
+
+    // All groups carved out of a few large arena blocks
+    bench.run("nested pmr::vector with arena", [&] {
+        flux::arena arena(1024 * 1024);
+        auto groups = flux::to<std::pmr::vector<std::pmr::vector<int>>>(
+            flux::chunk(flux::ref(ints), 3), &arena);
+        an::doNotOptimizeAway(groups);
+    });
+}
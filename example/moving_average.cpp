@@ -7,6 +7,7 @@
 #include <cstddef>
 #include <cassert>
 #include <deque>
+#include <functional>
 #include <vector>
 
 struct sliding_window_t
@@ -64,4 +65,13 @@ int main() {
     assert(ma2[0] == 4); // (1 + 5 + 6) / 3
     assert(ma2[1] == 4); // (5 + 6 + 1) / 3
     assert(ma2.back() == 2); // (7 + -1 + 0) / 3
+
+    // compute moving average by sliding_fold, which keeps a running sum,
+    // adding each new element and subtracting the one leaving the window
+    auto ma3 = flux::ref(intervals)
+        .sliding_fold(3, std::plus<>{}, std::minus<>{})
+        .map([](int sum) { return sum / 3; })
+        .to<std::vector>();
+
+    assert(flux::equal(ma3, ma2));
 }
@@ -15,15 +15,19 @@
 #include <flux/op/cache_last.hpp>
 #include <flux/op/cartesian_base.hpp>
 #include <flux/op/cartesian_power.hpp>
+#include <flux/op/cartesian_power_filter.hpp>
 #include <flux/op/cartesian_power_map.hpp>
 #include <flux/op/cartesian_product.hpp>
+#include <flux/op/cartesian_product_filter.hpp>
 #include <flux/op/cartesian_product_map.hpp>
 #include <flux/op/chain.hpp>
 #include <flux/op/chunk.hpp>
 #include <flux/op/chunk_by.hpp>
+#include <flux/op/chunk_records.hpp>
 #include <flux/op/compare.hpp>
 #include <flux/op/contains.hpp>
 #include <flux/op/count.hpp>
+#include <flux/op/csv.hpp>
 #include <flux/op/cursors.hpp>
 #include <flux/op/cycle.hpp>
 #include <flux/op/drop.hpp>
@@ -40,9 +44,12 @@
 #include <flux/op/for_each_while.hpp>
 #include <flux/op/from.hpp>
 #include <flux/op/inplace_reverse.hpp>
+#include <flux/op/lines.hpp>
 #include <flux/op/map.hpp>
 #include <flux/op/mask.hpp>
 #include <flux/op/minmax.hpp>
+#include <flux/op/parse.hpp>
+#include <flux/op/read_binary.hpp>
 #include <flux/op/read_only.hpp>
 #include <flux/op/ref.hpp>
 #include <flux/op/reverse.hpp>
@@ -51,6 +58,7 @@
 #include <flux/op/set_adaptors.hpp>
 #include <flux/op/slice.hpp>
 #include <flux/op/slide.hpp>
+#include <flux/op/sliding_fold.hpp>
 #include <flux/op/sort.hpp>
 #include <flux/op/split.hpp>
 #include <flux/op/split_string.hpp>
@@ -60,12 +68,16 @@
 #include <flux/op/take.hpp>
 #include <flux/op/take_while.hpp>
 #include <flux/op/to.hpp>
+#include <flux/op/transform_inplace.hpp>
 #include <flux/op/unchecked.hpp>
+#include <flux/op/write_binary.hpp>
 #include <flux/op/write_to.hpp>
 #include <flux/op/zip.hpp>
 #include <flux/op/zip_algorithms.hpp>
 
 #include <flux/source/array_ptr.hpp>
+#include <flux/source/async_generator.hpp>
+#include <flux/source/batch_generator.hpp>
 #include <flux/source/bitset.hpp>
 #include <flux/source/empty.hpp>
 #include <flux/source/generator.hpp>
@@ -78,4 +90,10 @@
 #include <flux/source/single.hpp>
 #include <flux/source/unfold.hpp>
 
+// Not included here, since they need threads or platform headers:
+//   <flux/op/par_text_chunks.hpp> and <flux/source/read_file_chunks.hpp>
+//     (link with Threads::Threads)
+//   <flux/source/event_loop.hpp> and <flux/source/mmap_file.hpp>
+// Nor is <flux/source/deque.hpp>, which makes std::deque a sequence.
+
 #endif
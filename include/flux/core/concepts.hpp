@@ -270,6 +270,33 @@ concept writable_sequence_of =
 
 namespace detail {
 
+// Stands in for the predicate passed to for_each_segment_while()
+struct segment_pred_archetype {
+    template <typename Seg>
+        requires contiguous_sequence<Seg> && sized_sequence<Seg>
+    auto operator()(Seg&) const -> distance_t;
+};
+
+template <typename Seq, typename Traits = sequence_traits<std::remove_cvref_t<Seq>>>
+concept segmented_sequence_concept =
+    sequence<Seq> &&
+    requires (Seq& seq, segment_pred_archetype& pred) {
+        { Traits::for_each_segment_while(seq, pred) } -> std::same_as<cursor_t<Seq>>;
+    };
+
+} // namespace detail
+
+/*
+ * A segmented sequence stores its elements in a series of contiguous, sized
+ * segments, such as the blocks of a std::deque or the inner vectors of a
+ * flattened vector-of-vectors. See for_each_segment_while().
+ */
+FLUX_EXPORT
+template <typename Seq>
+concept segmented_sequence = detail::segmented_sequence_concept<Seq>;
+
+namespace detail {
+
 template <typename>
 inline constexpr bool is_infinite_seq = false;
 
@@ -66,7 +66,12 @@ struct sequence_traits<T[N]> {
 
     static constexpr auto for_each_while(auto& self, auto&& pred) -> index_t
     {
-        index_t idx = 0;
+        return for_each_while_from(self, index_t{0}, pred);
+    }
+
+    static constexpr auto for_each_while_from(auto& self, index_t idx, auto&& pred) -> index_t
+    {
+        FLUX_DEBUG_ASSERT(idx >= 0);
         while (idx < N) {
             if (!std::invoke(pred, self[idx])) {
                 break;
@@ -231,7 +236,13 @@ struct sequence_traits<R> {
 
     static constexpr auto for_each_while(auto& self, auto&& pred) -> index_t
     {
-        auto iter = std::ranges::begin(self);
+        return for_each_while_from(self, index_t{0}, pred);
+    }
+
+    static constexpr auto for_each_while_from(auto& self, index_t idx, auto&& pred) -> index_t
+    {
+        FLUX_DEBUG_ASSERT(idx >= 0 && idx <= size(self));
+        auto iter = std::ranges::begin(self) + idx;
         auto const end = std::ranges::end(self);
 
         while (iter != end) {
@@ -122,6 +122,15 @@ public:
     [[nodiscard]]
     constexpr auto usize() const requires sized_sequence<Derived const> { return flux::usize(derived()); }
 
+    /// Returns lower and (if known) upper bounds on the number of elements
+    [[nodiscard]]
+    constexpr auto size_hint() -> size_bounds { return flux::size_hint(derived()); }
+
+    [[nodiscard]]
+    constexpr auto size_hint() const -> size_bounds
+        requires sequence<Derived const>
+    { return flux::size_hint(derived()); }
+
     /// Returns true if the sequence contains no elements
     [[nodiscard]]
     constexpr auto is_empty()
@@ -243,6 +252,9 @@ public:
     [[nodiscard]]
     constexpr auto chunk_by(Pred pred) &&;
 
+    [[nodiscard]]
+    constexpr auto chunk_records(char delim = '\n') &&;
+
     [[nodiscard]]
     constexpr auto cursors() && requires multipass_sequence<Derived>;
 
@@ -274,6 +286,9 @@ public:
     [[nodiscard]]
     constexpr auto flatten() && requires sequence<element_t<Derived>>;
 
+    [[nodiscard]]
+    constexpr auto lines(bool strip_cr = false) &&;
+
     template <typename Func>
         requires std::invocable<Func&, element_t<Derived>>
     [[nodiscard]]
@@ -317,6 +332,22 @@ public:
     [[nodiscard]]
     constexpr auto slide(std::integral auto win_sz) && requires multipass_sequence<Derived>;
 
+    template <typename D = Derived, typename Op, typename InvOp, typename Init = value_t<D>>
+        requires sliding_foldable<Derived, Op, InvOp, Init>
+    [[nodiscard]]
+    constexpr auto sliding_fold(std::integral auto win_sz, Op op, InvOp inv_op,
+                                Init init = Init{}) &&;
+
+    template <typename Cmp = std::ranges::less>
+        requires strict_weak_order_for<Cmp, Derived>
+    [[nodiscard]]
+    constexpr auto sliding_max(std::integral auto win_sz, Cmp cmp = Cmp{}) &&;
+
+    template <typename Cmp = std::ranges::less>
+        requires strict_weak_order_for<Cmp, Derived>
+    [[nodiscard]]
+    constexpr auto sliding_min(std::integral auto win_sz, Cmp cmp = Cmp{}) &&;
+
     template <typename Pattern>
         requires multipass_sequence<Derived> &&
                  multipass_sequence<Pattern> &&
@@ -325,14 +356,12 @@ public:
     constexpr auto split(Pattern&& pattern) &&;
 
     template <typename Delim>
-        requires multipass_sequence<Derived> &&
-                 std::equality_comparable_with<element_t<Derived>, Delim const&>
+        requires std::equality_comparable_with<element_t<Derived>, Delim const&>
     [[nodiscard]]
     constexpr auto split(Delim&& delim) &&;
 
     template <typename Pred>
-        requires multipass_sequence<Derived> &&
-                 std::predicate<Pred const&, element_t<Derived>>
+        requires std::predicate<Pred const&, element_t<Derived>>
     [[nodiscard]]
     constexpr auto split(Pred pred) &&;
 
@@ -489,10 +518,21 @@ public:
     constexpr auto starts_with(Needle&& needle, Cmp cmp = Cmp{}) -> bool;
 
     template <typename Container, typename... Args>
-    constexpr auto to(Args&&... args) -> Container;
+    constexpr auto to(Args&&... args) & -> Container;
+
+    template <typename Container, typename... Args>
+    constexpr auto to(Args&&... args) && -> Container;
+
+    template <typename Func>
+        requires std::invocable<Func&, element_t<Derived>> &&
+                 writable_sequence_of<Derived, std::invoke_result_t<Func&, element_t<Derived>>>
+    constexpr void transform_inplace(Func func);
+
+    template <template <typename...> typename Container, typename... Args>
+    constexpr auto to(Args&&... args) &;
 
     template <template <typename...> typename Container, typename... Args>
-    constexpr auto to(Args&&... args);
+    constexpr auto to(Args&&... args) &&;
 
     auto write_to(std::ostream& os) -> std::ostream&;
 };
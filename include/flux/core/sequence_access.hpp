@@ -11,6 +11,19 @@
 
 namespace flux {
 
+/*
+ * Bounds on the number of elements in a sequence, returned by size_hint().
+ * The sequence has at least `lower` elements, and at most `upper` elements
+ * if `upper` is engaged.
+ */
+FLUX_EXPORT
+struct size_bounds {
+    distance_t lower = 0;
+    optional<distance_t> upper = nullopt;
+
+    friend constexpr auto operator==(size_bounds const&, size_bounds const&) -> bool = default;
+};
+
 namespace detail {
 
 struct first_fn {
@@ -135,6 +148,85 @@ struct usize_fn {
     }
 };
 
+constexpr auto exact_size_bounds(distance_t n) -> size_bounds
+{
+    return {n, optional<distance_t>(n)};
+}
+
+template <typename Seq>
+concept has_custom_size_hint =
+    sequence<Seq> &&
+    requires (Seq& seq) {
+        { traits_t<Seq>::size_hint(seq) } -> std::same_as<size_bounds>;
+    };
+
+struct size_hint_fn {
+    template <sequence Seq>
+    [[nodiscard]]
+    constexpr auto operator()(Seq&& seq) const -> size_bounds
+    {
+        if constexpr (sized_sequence<Seq>) {
+            return exact_size_bounds(size_fn{}(seq));
+        } else if constexpr (has_custom_size_hint<Seq>) {
+            return traits_t<Seq>::size_hint(seq);
+        } else {
+            return {};
+        }
+    }
+};
+
+// Helpers for adaptors which combine the size hints of several sequences.
+// An upper bound which would overflow is treated as unknown.
+constexpr auto size_bounds_add(size_bounds const& lhs, size_bounds const& rhs)
+    -> size_bounds
+{
+    auto lower = num::overflowing_add(lhs.lower, rhs.lower);
+    size_bounds res{lower.overflowed ? std::numeric_limits<distance_t>::max()
+                                     : lower.value};
+    if (lhs.upper && rhs.upper) {
+        auto upper = num::overflowing_add(*lhs.upper, *rhs.upper);
+        if (!upper.overflowed) {
+            res.upper = optional<distance_t>(upper.value);
+        }
+    }
+    return res;
+}
+
+constexpr auto size_bounds_min(size_bounds const& lhs, size_bounds const& rhs)
+    -> size_bounds
+{
+    size_bounds res{lhs.lower < rhs.lower ? lhs.lower : rhs.lower};
+    if (lhs.upper && rhs.upper) {
+        res.upper = optional<distance_t>(*lhs.upper < *rhs.upper ? *lhs.upper : *rhs.upper);
+    } else if (lhs.upper) {
+        res.upper = lhs.upper;
+    } else {
+        res.upper = rhs.upper;
+    }
+    return res;
+}
+
+constexpr auto size_bounds_mul(size_bounds const& lhs, size_bounds const& rhs)
+    -> size_bounds
+{
+    auto lower = num::overflowing_mul(lhs.lower, rhs.lower);
+    size_bounds res{lower.overflowed ? std::numeric_limits<distance_t>::max()
+                                     : lower.value};
+    if (lhs.upper && rhs.upper) {
+        auto upper = num::overflowing_mul(*lhs.upper, *rhs.upper);
+        if (!upper.overflowed) {
+            res.upper = optional<distance_t>(upper.value);
+        }
+    }
+    return res;
+}
+
+// Bounds for an adaptor which yields at most as many elements as its base
+constexpr auto size_bounds_at_most(size_bounds const& bounds) -> size_bounds
+{
+    return {0, bounds.upper};
+}
+
 template <typename Seq>
 concept has_custom_move_at =
     sequence<Seq> &&
@@ -221,6 +313,7 @@ FLUX_EXPORT inline constexpr auto data = detail::data_fn{};
 FLUX_EXPORT inline constexpr auto last = detail::last_fn{};
 FLUX_EXPORT inline constexpr auto size = detail::size_fn{};
 FLUX_EXPORT inline constexpr auto usize = detail::usize_fn{};
+FLUX_EXPORT inline constexpr auto size_hint = detail::size_hint_fn{};
 
 namespace detail {
 
@@ -8,11 +8,17 @@
 
 #include <flux/core/inline_sequence_base.hpp>
 
+#include <algorithm>
+#include <array>
+#include <span>
+#include <utility>
+#include <vector>
+
 namespace flux {
 
 FLUX_EXPORT
 template <typename D>
-struct simple_sequence_base : inline_sequence_base<D> {};
+struct simple_sequence_base;
 
 namespace detail {
 
@@ -32,14 +38,138 @@ concept simple_sequence =
         { s.maybe_next() } -> optional_like;
     };
 
+template <typename S>
+using simple_optional_t = decltype(FLUX_DECLVAL(S&).maybe_next());
+
+template <typename S>
+using simple_value_t = std::remove_cvref_t<decltype(*FLUX_DECLVAL(simple_optional_t<S>&))>;
+
+/*
+ * Simple sequences may additionally provide
+ *
+ *     maybe_next_n(std::span<T> out) -> std::size_t
+ *
+ * which writes up to out.size() elements into `out` and returns how many it
+ * wrote, or zero once the sequence is exhausted. Internal iteration and
+ * flux::to() then pull elements a block at a time instead of one optional
+ * at a time.
+ */
+template <typename S>
+concept bulk_simple_sequence =
+    simple_sequence<S> &&
+    std::default_initializable<simple_value_t<S>> &&
+    std::movable<simple_value_t<S>> &&
+    std::constructible_from<simple_optional_t<S>, simple_value_t<S>&&> &&
+    requires (S& s, std::span<simple_value_t<S>> out) {
+        { s.maybe_next_n(out) } -> std::convertible_to<std::size_t>;
+    };
+
+// Up to 256 elements, but no more than 16KiB of stack
+template <typename T>
+inline constexpr std::size_t bulk_block_size =
+    sizeof(T) * 256 <= 16 * 1024 ? 256
+    : sizeof(T) >= 16 * 1024     ? 1
+                                 : 16 * 1024 / sizeof(T);
+
+// Elements which were pulled in bulk, but not consumed by internal iteration.
+// These belong to the sequence rather than to a cursor, so they survive the
+// cursor being dropped.
+template <typename S>
+struct bulk_pending {
+    std::vector<simple_value_t<S>> elems;
+    std::size_t next = 0;
+};
+
+struct simple_sequence_access;
+
+} // namespace detail
+
+template <typename D>
+struct simple_sequence_base : inline_sequence_base<D> {
+    constexpr simple_sequence_base() = default;
+
+    constexpr simple_sequence_base(simple_sequence_base const& other)
+    {
+        if constexpr (detail::bulk_simple_sequence<D>) {
+            if (other.pending_ != nullptr) {
+                pending_ = new detail::bulk_pending<D>(*other.pending_);
+            }
+        }
+    }
+
+    constexpr simple_sequence_base(simple_sequence_base&& other) noexcept
+        : pending_(std::exchange(other.pending_, nullptr))
+    {}
+
+    constexpr auto operator=(simple_sequence_base other) noexcept -> simple_sequence_base&
+    {
+        std::swap(pending_, other.pending_);
+        return *this;
+    }
+
+    constexpr ~simple_sequence_base()
+    {
+        if constexpr (detail::bulk_simple_sequence<D>) {
+            delete pending_;
+        }
+    }
+
+private:
+    friend struct detail::simple_sequence_access;
+
+    detail::bulk_pending<D>* pending_ = nullptr;
+};
+
+namespace detail {
+
+struct simple_sequence_access {
+    template <typename S>
+    static constexpr auto pending(S& seq) -> bulk_pending<S>*&
+    {
+        return static_cast<simple_sequence_base<S>&>(seq).pending_;
+    }
+};
+
+// Fills `out` with any pending elements first, and only then asks the
+// sequence for more
+template <bulk_simple_sequence S>
+constexpr auto bulk_next_n(S& seq, std::span<simple_value_t<S>> out) -> std::size_t
+{
+    if (auto* p = simple_sequence_access::pending(seq); p && p->next < p->elems.size()) {
+        auto const n = std::min(out.size(), p->elems.size() - p->next);
+        auto const from = p->elems.begin() + static_cast<std::ptrdiff_t>(p->next);
+        std::move(from, from + static_cast<std::ptrdiff_t>(n), out.begin());
+        p->next += n;
+        return n;
+    }
+    return seq.maybe_next_n(out);
+}
+
+// Puts [first, last) back in front of any pending elements
+template <bulk_simple_sequence S>
+constexpr void unread_n(S& seq, simple_value_t<S>* first, simple_value_t<S>* last)
+{
+    auto*& p = simple_sequence_access::pending(seq);
+    if (p == nullptr) {
+        p = new bulk_pending<S>{};
+    }
+    auto& elems = p->elems;
+    elems.erase(elems.begin(), elems.begin() + static_cast<std::ptrdiff_t>(p->next));
+    elems.insert(elems.begin(), std::make_move_iterator(first), std::make_move_iterator(last));
+    p->next = 0;
+}
+
 } // namespace detail
 
 template <detail::simple_sequence S>
 struct sequence_traits<S> {
 private:
+    static constexpr bool is_bulk = detail::bulk_simple_sequence<S>;
+
+    using optional_t = detail::simple_optional_t<S>;
+
     class cursor_type {
         friend struct sequence_traits;
-        using optional_t = decltype(FLUX_DECLVAL(S&).maybe_next());
         optional_t opt_{};
 
         constexpr cursor_type() = default;
@@ -53,12 +183,24 @@ private:
         cursor_type& operator=(cursor_type&&) = default;
     };
 
+    // Elements left over from a bulk read come before any new ones
+    static constexpr auto next(S& self) -> optional_t
+    {
+        if constexpr (is_bulk) {
+            auto* p = detail::simple_sequence_access::pending(self);
+            if (p != nullptr && p->next < p->elems.size()) {
+                return optional_t(std::move(p->elems[p->next++]));
+            }
+        }
+        return self.maybe_next();
+    }
+
 public:
     static constexpr bool is_infinite = detail::is_infinite_seq<S>;
 
     static constexpr auto first(S& self) -> cursor_type
     {
-        return cursor_type(self.maybe_next());
+        return cursor_type(next(self));
     }
 
     static constexpr auto is_last(S&, cursor_type const& cur) -> bool
@@ -68,7 +210,7 @@ public:
 
     static constexpr auto inc(S& self, cursor_type& cur) -> cursor_type&
     {
-        cur.opt_ = self.maybe_next();
+        cur.opt_ = next(self);
         return cur;
     }
 
@@ -79,12 +221,30 @@ public:
 
     static constexpr auto for_each_while(S& self, auto&& pred) -> cursor_type
     {
-        while (auto o = self.maybe_next()) {
-            if (!std::invoke(pred, *o)) {
-                return cursor_type(std::move(o));
+        if constexpr (is_bulk) {
+            using value_type = detail::simple_value_t<S>;
+            std::array<value_type, detail::bulk_block_size<value_type>> buf;
+
+            while (std::size_t n = detail::bulk_next_n(self, std::span<value_type>(buf))) {
+                FLUX_DEBUG_ASSERT(n <= buf.size());
+                for (std::size_t i = 0; i < n; ++i) {
+                    if (!std::invoke(pred, std::as_const(buf[i]))) {
+                        // Keep the rest of the block, so that later reads
+                        // from the sequence don't skip any elements
+                        detail::unread_n(self, buf.data() + i + 1, buf.data() + n);
+                        return cursor_type(optional_t(std::move(buf[i])));
+                    }
+                }
+            }
+            return cursor_type{};
+        } else {
+            while (auto o = next(self)) {
+                if (!std::invoke(pred, *o)) {
+                    return cursor_type(std::move(o));
+                }
             }
+            return cursor_type{};
         }
-        return cursor_type{};
     }
 };
 
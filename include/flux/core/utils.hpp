@@ -75,6 +75,9 @@ namespace detail {
 template <typename T, typename... U>
 concept any_of = (std::same_as<T, U> || ...);
 
+template <typename C>
+concept character = any_of<C, char, wchar_t, char8_t, char16_t, char32_t>;
+
 } // namespace detail
 
 } // namespace flux
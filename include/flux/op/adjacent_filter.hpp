@@ -98,6 +98,13 @@ public:
         {
             return cursor_type{flux::last(self.base_)};
         }
+
+        // The first element is always kept
+        static constexpr auto size_hint(auto& self) -> size_bounds
+        {
+            auto bounds = flux::size_hint(self.base_);
+            return {(cmp::min)(bounds.lower, distance_t{1}), bounds.upper};
+        }
     };
 };
 
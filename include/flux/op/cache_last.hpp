@@ -29,7 +29,7 @@ public:
         : base_(FLUX_FWD(base))
     {}
 
-    struct flux_sequence_traits : detail::passthrough_traits_base<Base> {
+    struct flux_sequence_traits : detail::same_elements_traits_base<Base> {
 
         using value_type = value_t<Base>;
         using self_t = cache_last_adaptor;
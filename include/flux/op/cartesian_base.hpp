@@ -30,6 +30,22 @@ struct tuple_repeated {
 template <typename T, std::size_t RepeatCount>
 using tuple_repeated_t = tuple_repeated<T, RepeatCount>::type;
 
+template <typename Seq>
+concept has_custom_for_each_while =
+    requires (Seq& seq, bool (*pred)(element_t<Seq>)) {
+        traits_t<Seq>::for_each_while(seq, pred);
+    };
+
+// If the innermost base is random-access and sized, we know the trip count of
+// the inner loop up-front and can use unchecked reads. We don't do this for
+// sequences with their own internal iteration (e.g. chain()) unless they are
+// contiguous, as that would be a pessimisation.
+template <typename Seq>
+concept cartesian_counted_inner_loop =
+    random_access_sequence<Seq> &&
+    sized_sequence<Seq> &&
+    (contiguous_sequence<Seq> || !has_custom_for_each_while<Seq>);
+
 template<std::size_t Arity, cartesian_kind CartesianKind, read_kind ReadKind, typename... Bases>
 struct cartesian_traits_types {
 };
@@ -163,6 +179,20 @@ private:
         }(std::make_index_sequence<Arity>{});
     }
 
+    template <typename Base, typename Function>
+    static constexpr auto counted_for_each_while(Base& base, cursor_t<Base> cur,
+                                                 distance_t count, Function& func)
+        -> cursor_t<Base>
+    {
+        for (; count > 0; --count) {
+            if (!std::invoke(func, flux::read_at_unchecked(base, cur))) {
+                break;
+            }
+            flux::inc(base, cur);
+        }
+        return cur;
+    }
+
     template <std::size_t I, typename Self, typename Function,
             typename... PartialElements>
     static constexpr void for_each_while_impl(Self& self,
@@ -173,12 +203,19 @@ private:
     {
         // We need to iterate right to left.
         if constexpr (I == Arity - 1) {
-            std::get<I>(cur) = flux::for_each_while(get_base<I>(self),
-                [&](auto&& elem) {
-                    keep_going = std::invoke(func,
-                                             element_t<Self>(FLUX_FWD(partial_elements)..., FLUX_FWD(elem)));
-                    return keep_going;
-                });
+            auto body = [&](auto&& elem) {
+                keep_going = std::invoke(func,
+                                         element_t<Self>(FLUX_FWD(partial_elements)..., FLUX_FWD(elem)));
+                return keep_going;
+            };
+
+            auto& base = get_base<I>(self);
+            if constexpr (cartesian_counted_inner_loop<decltype(base)>) {
+                std::get<I>(cur) = counted_for_each_while(base, flux::first(base),
+                                                          flux::size(base), body);
+            } else {
+                std::get<I>(cur) = flux::for_each_while(base, body);
+            }
         } else {
             std::get<I>(cur) = flux::for_each_while(get_base<I>(self),
                 [&](auto&& elem) {
@@ -190,6 +227,46 @@ private:
         }
     }
 
+    // As above, but the first pass at each level starts from the position
+    // given by `cur` rather than from the start of the base
+    template <std::size_t I, typename Self, typename Function,
+            typename... PartialElements>
+    static constexpr void for_each_while_from_impl(Self& self,
+                                                   bool& keep_going,
+                                                   bool& resuming,
+                                                   cursor_t<Self>& cur,
+                                                   Function&& func,
+                                                   PartialElements&&... partial_elements)
+    {
+        auto body = [&](auto&& elem) {
+            if constexpr (I == Arity - 1) {
+                keep_going = std::invoke(func,
+                                         element_t<Self>(FLUX_FWD(partial_elements)..., FLUX_FWD(elem)));
+            } else if (resuming) {
+                for_each_while_from_impl<I+1>(
+                        self, keep_going, resuming, cur,
+                        func, FLUX_FWD(partial_elements)..., FLUX_FWD(elem));
+            } else {
+                for_each_while_impl<I+1>(
+                        self, keep_going, cur,
+                        func, FLUX_FWD(partial_elements)..., FLUX_FWD(elem));
+            }
+            return keep_going;
+        };
+
+        auto& base = get_base<I>(self);
+        auto from = std::move(std::get<I>(cur));
+        if constexpr (I == Arity - 1) {
+            resuming = false;
+            if constexpr (cartesian_counted_inner_loop<decltype(base)>) {
+                auto count = flux::size(base) - flux::distance(base, flux::first(base), from);
+                std::get<I>(cur) = counted_for_each_while(base, std::move(from), count, body);
+                return;
+            }
+        }
+        std::get<I>(cur) = detail::for_each_while_from(base, std::move(from), body);
+    }
+
 protected:
     using types = cartesian_traits_types<Arity, CartesianKind, ReadKind, Bases...>;
 
@@ -236,6 +313,29 @@ public:
         return num::checked_pow(flux::size(self.base_), Arity);
     }
 
+    template <typename Self>
+    static constexpr auto size_hint(Self& self) -> size_bounds
+        requires (CartesianKind == cartesian_kind::product)
+    {
+        return std::apply([](auto& base0, auto&... bases) {
+            size_bounds res = flux::size_hint(base0);
+            ((res = detail::size_bounds_mul(res, flux::size_hint(bases))), ...);
+            return res;
+        }, self.bases_);
+    }
+
+    template <typename Self>
+    static constexpr auto size_hint(Self& self) -> size_bounds
+        requires (CartesianKind == cartesian_kind::power)
+    {
+        auto bounds = flux::size_hint(self.base_);
+        auto res = exact_size_bounds(1);
+        for (std::size_t i = 0; i < Arity; i++) {
+            res = detail::size_bounds_mul(res, bounds);
+        }
+        return res;
+    }
+
     template <typename Self>
     static constexpr auto is_last(Self& self, cursor_t<Self> const& cur) -> bool
     {
@@ -345,6 +445,17 @@ public:
         return cur;
     }
 
+    template <typename Self, typename Function>
+    static constexpr auto for_each_while_from(Self& self, cursor_t<Self> from, Function&& func)
+    -> cursor_t<Self>
+        requires (ReadKind == read_kind::tuple)
+    {
+        bool keep_going = true;
+        bool resuming = true;
+        for_each_while_from_impl<0>(self, keep_going, resuming, from, FLUX_FWD(func));
+        return from;
+    }
+
 };
 
 template <std::size_t Arity, cartesian_kind CartesianKind, read_kind ReadKind, typename... Bases>
@@ -359,6 +470,221 @@ struct cartesian_traits_base<Arity, CartesianKind, read_kind::tuple, Bases...> :
     using value_type = typename impl::types::value_type;
 };
 
+
+/*
+ * Pruning cartesian products
+ *
+ * Each level I of the product has an associated predicate which is called
+ * with the elements at levels 0...I. If it returns false then we skip the
+ * whole subtree of the product rooted at that prefix.
+ */
+template <typename Pred, typename ElemTuple, std::size_t... Js>
+consteval auto is_cartesian_prefix_predicate(std::index_sequence<Js...>) -> bool
+{
+    return std::predicate<Pred&, std::tuple_element_t<Js, ElemTuple>...>;
+}
+
+template <typename PredTuple, typename ElemTuple, std::size_t... Is>
+consteval auto are_cartesian_prefix_predicates(std::index_sequence<Is...>) -> bool
+{
+    return (is_cartesian_prefix_predicate<std::tuple_element_t<Is, PredTuple>, ElemTuple>(
+                std::make_index_sequence<Is + 1>{}) && ...);
+}
+
+template <typename PredTuple, typename ElemTuple>
+concept cartesian_prefix_predicates =
+    std::tuple_size_v<PredTuple> == std::tuple_size_v<ElemTuple> &&
+    are_cartesian_prefix_predicates<PredTuple, ElemTuple>(
+        std::make_index_sequence<std::tuple_size_v<PredTuple>>{});
+
+template <std::size_t Arity, cartesian_kind CartesianKind, typename... Bases>
+struct cartesian_filter_traits_base_impl {
+private:
+    template<std::size_t I, typename Self>
+    static constexpr auto& get_base(Self& self)
+        requires (CartesianKind == cartesian_kind::power)
+    {
+        return self.base_;
+    }
+
+    template<std::size_t I, typename Self>
+    static constexpr auto& get_base(Self& self)
+        requires (CartesianKind == cartesian_kind::product)
+    {
+        return std::get<I>(self.bases_);
+    }
+
+    template <typename Self>
+    static constexpr auto first_cursors(Self& self)
+    {
+        if constexpr (CartesianKind == cartesian_kind::product) {
+            return std::apply([](auto&&... args) {
+                return std::tuple(flux::first(FLUX_FWD(args))...);
+            }, self.bases_);
+        } else {
+            auto base_cur = flux::first(self.base_);
+            return [&base_cur]<std::size_t... Is>(std::index_sequence<Is...>) {
+                std::array<cursor_t<Bases>..., Arity> cur = {(static_cast<void>(Is), base_cur)...};
+                return cur;
+            }(std::make_index_sequence<Arity>{});
+        }
+    }
+
+    // Once the outermost base is exhausted, reset the inner cursors so that
+    // all past-the-end cursors compare equal
+    template <typename Self>
+    static constexpr void reset_inner(Self& self, auto& cur)
+    {
+        [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+            ((std::get<Is + 1>(cur) = flux::first(get_base<Is + 1>(self))), ...);
+        }(std::make_index_sequence<Arity - 1>{});
+    }
+
+    template <std::size_t I, typename Self>
+    static constexpr auto test_prefix(Self& self, auto const& cur) -> bool
+    {
+        return [&]<std::size_t... Js>(std::index_sequence<Js...>) -> bool {
+            return std::invoke(std::get<I>(self.preds_),
+                               flux::read_at(get_base<Js>(self), std::get<Js>(cur))...);
+        }(std::make_index_sequence<I + 1>{});
+    }
+
+    // Starting from the current position at level I, moves `cur` to the
+    // first position whose prefixes satisfy all the predicates from level I
+    // inwards. Returns false if level I is exhausted.
+    template <std::size_t I, typename Self>
+    static constexpr auto descend(Self& self, auto& cur) -> bool
+    {
+        auto& base = get_base<I>(self);
+        for (; !flux::is_last(base, std::get<I>(cur)); flux::inc(base, std::get<I>(cur))) {
+            if (!test_prefix<I>(self, cur)) {
+                continue;
+            }
+            if constexpr (I == Arity - 1) {
+                return true;
+            } else {
+                std::get<I + 1>(cur) = flux::first(get_base<I + 1>(self));
+                if (descend<I + 1>(self, cur)) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    template <std::size_t I, typename Self>
+    static constexpr auto advance(Self& self, auto& cur) -> bool
+    {
+        if (descend<I>(self, cur)) {
+            return true;
+        }
+        if constexpr (I == 0) {
+            return false;
+        } else {
+            flux::inc(get_base<I - 1>(self), std::get<I - 1>(cur));
+            return advance<I - 1>(self, cur);
+        }
+    }
+
+    template <std::size_t I, typename Self, typename Function,
+              typename... PartialElements>
+    static constexpr void for_each_while_impl(Self& self,
+                                              bool& keep_going,
+                                              cursor_t<Self>& cur,
+                                              Function& func,
+                                              PartialElements&&... partial_elements)
+    {
+        std::get<I>(cur) = flux::for_each_while(get_base<I>(self),
+            [&](auto&& elem) {
+                if (!std::invoke(std::get<I>(self.preds_), partial_elements..., elem)) {
+                    return true;
+                }
+                if constexpr (I == Arity - 1) {
+                    keep_going = std::invoke(func,
+                                             element_t<Self>(FLUX_FWD(partial_elements)..., FLUX_FWD(elem)));
+                } else {
+                    for_each_while_impl<I + 1>(
+                            self, keep_going, cur,
+                            func, FLUX_FWD(partial_elements)..., FLUX_FWD(elem));
+                }
+                return keep_going;
+            });
+    }
+
+    template <typename Fn, typename Self>
+    static constexpr auto read_(Fn& fn, Self& self, cursor_t<Self> const& cur)
+    {
+        return [&]<std::size_t... N>(std::index_sequence<N...>) {
+            return std::tuple<decltype(fn(get_base<N>(self), std::get<N>(cur)))...>(
+                fn(get_base<N>(self), std::get<N>(cur))...);
+        }(std::make_index_sequence<Arity>{});
+    }
+
+public:
+    using value_type = typename cartesian_traits_types<
+        Arity, CartesianKind, read_kind::tuple, Bases...>::value_type;
+
+    template <typename Self>
+    static constexpr auto first(Self& self)
+    {
+        auto cur = first_cursors(self);
+        if (!descend<0>(self, cur)) {
+            reset_inner(self, cur);
+        }
+        return cur;
+    }
+
+    template <typename Self>
+    static constexpr auto is_last(Self& self, cursor_t<Self> const& cur) -> bool
+    {
+        return flux::is_last(get_base<0>(self), std::get<0>(cur));
+    }
+
+    template <typename Self>
+    static constexpr auto inc(Self& self, cursor_t<Self>& cur) -> cursor_t<Self>&
+    {
+        flux::inc(get_base<Arity - 1>(self), std::get<Arity - 1>(cur));
+        if (!advance<Arity - 1>(self, cur)) {
+            reset_inner(self, cur);
+        }
+        return cur;
+    }
+
+    template <typename Self>
+    static constexpr auto last(Self& self) -> cursor_t<Self>
+        requires cartesian_is_bounded<Bases...>
+    {
+        auto cur = first_cursors(self);
+        std::get<0>(cur) = flux::last(get_base<0>(self));
+        return cur;
+    }
+
+    template <typename Self>
+    static constexpr auto read_at(Self& self, cursor_t<Self> const& cur)
+    {
+        return read_(flux::read_at, self, cur);
+    }
+
+    template <typename Self>
+    static constexpr auto move_at(Self& self, cursor_t<Self> const& cur)
+    {
+        return read_(flux::move_at, self, cur);
+    }
+
+    template <typename Self, typename Function>
+    static constexpr auto for_each_while(Self& self, Function&& func)
+    -> cursor_t<Self>
+    {
+        bool keep_going = true;
+        cursor_t<Self> cur;
+        for_each_while_impl<0>(self, keep_going, cur, func);
+        if (keep_going) {
+            reset_inner(self, cur);
+        }
+        return cur;
+    }
+};
+
 }
 
 #endif //FLUX_CARTESIAN_BASE_HPP_INCLUDED
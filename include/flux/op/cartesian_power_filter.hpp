@@ -0,0 +1,70 @@
+
+// Copyright (c) 2022 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef FLUX_OP_CARTESIAN_POWER_FILTER_HPP_INCLUDED
+#define FLUX_OP_CARTESIAN_POWER_FILTER_HPP_INCLUDED
+
+#include <flux/core.hpp>
+#include <flux/op/cartesian_base.hpp>
+#include <flux/source/empty.hpp>
+
+#include <tuple>
+
+namespace flux {
+
+namespace detail {
+
+template <std::size_t PowN, typename PredTuple, sequence Base>
+struct cartesian_power_filter_adaptor
+    : inline_sequence_base<cartesian_power_filter_adaptor<PowN, PredTuple, Base>> {
+private:
+    FLUX_NO_UNIQUE_ADDRESS Base base_;
+    FLUX_NO_UNIQUE_ADDRESS PredTuple preds_;
+
+public:
+    constexpr explicit cartesian_power_filter_adaptor(decays_to<PredTuple> auto&& preds,
+                                                      decays_to<Base> auto&& base)
+        : base_(FLUX_FWD(base)),
+          preds_(FLUX_FWD(preds))
+    {}
+
+    using flux_sequence_traits = cartesian_filter_traits_base_impl<
+        PowN,
+        cartesian_kind::power,
+        Base
+    >;
+    friend flux_sequence_traits;
+};
+
+template <std::size_t PowN>
+struct cartesian_power_filter_fn {
+
+    template <typename... Preds, adaptable_sequence Seq>
+        requires multipass_sequence<Seq> &&
+                 (sizeof...(Preds) == PowN) &&
+                 cartesian_prefix_predicates<std::tuple<Preds...>,
+                                             tuple_repeated_t<element_t<Seq>, PowN>>
+    [[nodiscard]]
+    constexpr auto operator()(std::tuple<Preds...> preds, Seq&& seq) const
+    {
+        if constexpr (PowN == 0) {
+            return empty<std::tuple<>>;
+        } else {
+            return cartesian_power_filter_adaptor<PowN, std::tuple<Preds...>, std::decay_t<Seq>>(
+                std::move(preds), FLUX_FWD(seq));
+        }
+    }
+};
+
+} // namespace detail
+
+FLUX_EXPORT
+template <distance_t N>
+    requires (N >= 0)
+inline constexpr auto cartesian_power_filter = detail::cartesian_power_filter_fn<N>{};
+
+} // namespace flux
+
+#endif
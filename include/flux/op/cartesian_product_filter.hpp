@@ -0,0 +1,61 @@
+
+// Copyright (c) 2022 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef FLUX_OP_CARTESIAN_PRODUCT_FILTER_HPP_INCLUDED
+#define FLUX_OP_CARTESIAN_PRODUCT_FILTER_HPP_INCLUDED
+
+#include <flux/core.hpp>
+#include <flux/op/cartesian_base.hpp>
+
+#include <tuple>
+
+namespace flux {
+
+namespace detail {
+
+template <typename PredTuple, sequence... Bases>
+struct cartesian_product_filter_adaptor
+    : inline_sequence_base<cartesian_product_filter_adaptor<PredTuple, Bases...>> {
+private:
+    FLUX_NO_UNIQUE_ADDRESS std::tuple<Bases...> bases_;
+    FLUX_NO_UNIQUE_ADDRESS PredTuple preds_;
+
+public:
+    constexpr explicit cartesian_product_filter_adaptor(decays_to<PredTuple> auto&& preds,
+                                                        decays_to<Bases> auto&&... bases)
+        : bases_(FLUX_FWD(bases)...),
+          preds_(FLUX_FWD(preds))
+    {}
+
+    using flux_sequence_traits = cartesian_filter_traits_base_impl<
+        sizeof...(Bases),
+        cartesian_kind::product,
+        Bases...
+    >;
+    friend flux_sequence_traits;
+};
+
+struct cartesian_product_filter_fn
+{
+    template <typename... Preds, adaptable_sequence Seq0, adaptable_sequence... Seqs>
+        requires (multipass_sequence<Seqs> && ...) &&
+                 cartesian_prefix_predicates<std::tuple<Preds...>,
+                                             std::tuple<element_t<Seq0>, element_t<Seqs>...>>
+    [[nodiscard]]
+    constexpr auto operator()(std::tuple<Preds...> preds, Seq0&& seq0, Seqs&&... seqs) const
+    {
+        return cartesian_product_filter_adaptor<std::tuple<Preds...>,
+                                                std::decay_t<Seq0>, std::decay_t<Seqs>...>(
+                    std::move(preds), FLUX_FWD(seq0), FLUX_FWD(seqs)...);
+    }
+};
+
+} // namespace detail
+
+FLUX_EXPORT inline constexpr auto cartesian_product_filter = detail::cartesian_product_filter_fn{};
+
+} // namespace flux
+
+#endif
@@ -7,6 +7,7 @@
 #define FLUX_OP_CHAIN_HPP_INCLUDED
 
 #include <flux/core.hpp>
+#include <flux/op/for_each_while.hpp>
 
 #include <tuple>
 #include <variant>
@@ -180,6 +181,50 @@ private:
         }
     }
 
+    template <std::size_t N, typename Self>
+    static constexpr auto for_each_while_from_impl(Self& self, cursor_type&& from, auto& pred)
+        -> cursor_type
+    {
+        if constexpr (N < End) {
+            if (from.index() != N) {
+                return for_each_while_from_impl<N+1>(self, std::move(from), pred);
+            }
+            auto& base = std::get<N>(self.bases_);
+            auto base_cur = detail::for_each_while_from(base, std::get<N>(std::move(from)),
+                                                        std::ref(pred));
+            if (!flux::is_last(base, base_cur)) {
+                return cursor_type(std::in_place_index<N>, std::move(base_cur));
+            } else {
+                return for_each_while_impl<N+1>(self, pred);
+            }
+        } else {
+            return cursor_type(std::in_place_index<N>,
+                               detail::for_each_while_from(std::get<N>(self.bases_),
+                                                           std::get<N>(std::move(from)),
+                                                           std::ref(pred)));
+        }
+    }
+
+    template <std::size_t N, typename Self>
+    static constexpr auto for_each_while_strided_impl(Self& self, auto& pred,
+                                                      distance_t stride, distance_t& skip)
+        -> cursor_type
+    {
+        if constexpr (N < End) {
+            auto& base = std::get<N>(self.bases_);
+            auto base_cur = detail::for_each_while_strided(base, std::ref(pred), stride, skip);
+            if (!flux::is_last(base, base_cur)) {
+                return cursor_type(std::in_place_index<N>, std::move(base_cur));
+            } else {
+                return for_each_while_strided_impl<N+1>(self, pred, stride, skip);
+            }
+        } else {
+            return cursor_type(std::in_place_index<N>,
+                               detail::for_each_while_strided(std::get<N>(self.bases_),
+                                                              std::ref(pred), stride, skip));
+        }
+    }
+
     template <std::size_t N, typename Self>
     static constexpr auto distance_impl(Self& self,
                                         cursor_type const& from,
@@ -293,12 +338,37 @@ public:
                           self.bases_);
     }
 
+    template <typename Self>
+    static constexpr auto size_hint(Self& self) -> size_bounds
+        requires (sequence<const_like_t<Self, Bases>> && ...)
+    {
+        return std::apply([](auto&... bases) {
+            auto res = detail::exact_size_bounds(0);
+            ((res = detail::size_bounds_add(res, flux::size_hint(bases))), ...);
+            return res;
+        }, self.bases_);
+    }
+
     template <typename Self>
     static constexpr auto for_each_while(Self& self, auto&& pred)
     {
         return for_each_while_impl<0>(self, pred);
     }
 
+    template <typename Self>
+    static constexpr auto for_each_while_from(Self& self, cursor_type from, auto&& pred)
+        -> cursor_type
+    {
+        return for_each_while_from_impl<0>(self, std::move(from), pred);
+    }
+
+    template <typename Self>
+    static constexpr auto for_each_while_strided(Self& self, auto&& pred,
+                                                 distance_t stride, distance_t& skip)
+    {
+        return for_each_while_strided_impl<0>(self, pred, stride, skip);
+    }
+
     template <typename Self>
     static constexpr auto distance(Self& self, cursor_type const& from,
                                    cursor_type const& to)
@@ -131,6 +131,13 @@ public:
             auto s = flux::size(self.base_);
             return s/self.chunk_sz_ + (s % self.chunk_sz_ == 0 ? 0 : 1);
         }
+
+        static constexpr auto size_hint(self_t& self) -> size_bounds
+        {
+            auto bounds = flux::size_hint(self.base_);
+            auto div = [&](distance_t s) { return s/self.chunk_sz_ + (s % self.chunk_sz_ == 0 ? 0 : 1); };
+            return {div(bounds.lower), bounds.upper.map(div)};
+        }
     };
 };
 
@@ -183,6 +190,13 @@ public:
             auto s = flux::size(self.base_);
             return s/self.chunk_sz_ + (s % self.chunk_sz_ == 0 ? 0 : 1);
         }
+
+        static constexpr auto size_hint(auto& self) -> size_bounds
+        {
+            auto bounds = flux::size_hint(self.base_);
+            auto div = [&](distance_t s) { return s/self.chunk_sz_ + (s % self.chunk_sz_ == 0 ? 0 : 1); };
+            return {div(bounds.lower), bounds.upper.map(div)};
+        }
     };
 };
 
@@ -275,6 +289,13 @@ public:
             return s/self.chunk_sz_ + (s % self.chunk_sz_ == 0 ? 0 : 1);
         }
 
+        static constexpr auto size_hint(auto& self) -> size_bounds
+        {
+            auto bounds = flux::size_hint(self.base_);
+            auto div = [&](distance_t s) { return s/self.chunk_sz_ + (s % self.chunk_sz_ == 0 ? 0 : 1); };
+            return {div(bounds.lower), bounds.upper.map(div)};
+        }
+
         static constexpr auto distance(auto& self, cursor_type const& from, cursor_type const& to)
             -> distance_t
             requires random_access_sequence<Base>
@@ -109,6 +109,13 @@ public:
             return cursor_type{flux::last(self.base_), flux::last(self.base_)};
         }
 
+        // Every chunk is non-empty
+        static constexpr auto size_hint(auto& self) -> size_bounds
+        {
+            auto bounds = flux::size_hint(self.base_);
+            return {(cmp::min)(bounds.lower, distance_t{1}), bounds.upper};
+        }
+
         static constexpr auto dec(auto& self, cursor_type& cur) -> void
             requires bidirectional_sequence<Base>
         {
@@ -0,0 +1,192 @@
+
+// Copyright (c) 2023 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef FLUX_OP_CHUNK_RECORDS_HPP_INCLUDED
+#define FLUX_OP_CHUNK_RECORDS_HPP_INCLUDED
+
+#include <flux/core.hpp>
+
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace flux {
+
+namespace detail {
+
+template <typename Chunk>
+concept char_chunk = contiguous_sequence<Chunk> && sized_sequence<Chunk> &&
+                     std::same_as<value_t<Chunk>, char>;
+
+/*
+ * Takes a sequence of contiguous blocks of chars (for example the output of
+ * read_file_chunks()) and splits their concatenation into records ending in
+ * `delim`. Records which lie entirely within one block are returned as views
+ * into it; records which straddle a block boundary are assembled in an
+ * internal buffer. Either way the yielded string_view is only valid until the
+ * next call to inc().
+ */
+template <sequence Base>
+    requires char_chunk<element_t<Base>>
+struct chunk_records_adaptor : inline_sequence_base<chunk_records_adaptor<Base>> {
+private:
+    using chunk_t = element_t<Base>;
+
+    // If the base yields prvalues, we need to keep the current one alive
+    struct no_held_chunk {};
+    using held_chunk_t = std::conditional_t<std::is_reference_v<chunk_t>,
+                                            no_held_chunk,
+                                            std::optional<std::remove_cv_t<chunk_t>>>;
+
+    FLUX_NO_UNIQUE_ADDRESS Base base_;
+    std::optional<cursor_t<Base>> cur_{};
+    FLUX_NO_UNIQUE_ADDRESS held_chunk_t held_{};
+    std::string_view chunk_{}; // the unconsumed part of the current block
+    std::string carry_{};
+    std::string_view record_{};
+    char delim_;
+    bool record_in_carry_ = false;
+    bool base_done_ = false;
+    bool done_ = false;
+
+    constexpr auto next_chunk() -> bool
+    {
+        if (base_done_) {
+            return false;
+        } else if (!cur_.has_value()) {
+            cur_.emplace(flux::first(base_));
+        } else {
+            flux::inc(base_, *cur_);
+        }
+
+        if (flux::is_last(base_, *cur_)) {
+            base_done_ = true;
+            return false;
+        }
+
+        if constexpr (std::is_reference_v<chunk_t>) {
+            auto& chunk = flux::read_at(base_, *cur_);
+            chunk_ = std::string_view(flux::data(chunk),
+                                      static_cast<std::size_t>(flux::size(chunk)));
+        } else {
+            auto& chunk = held_.emplace(flux::read_at(base_, *cur_));
+            chunk_ = std::string_view(flux::data(chunk),
+                                      static_cast<std::size_t>(flux::size(chunk)));
+        }
+        return true;
+    }
+
+    constexpr auto advance() -> void
+    {
+        if (record_in_carry_) {
+            carry_.clear();
+            record_in_carry_ = false;
+        }
+
+        while (true) {
+            auto const pos = chunk_.find(delim_);
+            if (pos != std::string_view::npos) {
+                if (carry_.empty()) {
+                    record_ = chunk_.substr(0, pos);
+                } else {
+                    carry_.append(chunk_.data(), pos);
+                    record_ = carry_;
+                    record_in_carry_ = true;
+                }
+                chunk_.remove_prefix(pos + 1);
+                return;
+            }
+
+            // The current record continues into the next block, so we need
+            // to save what we have before the base invalidates it
+            carry_.append(chunk_);
+            chunk_ = {};
+
+            if (!next_chunk()) {
+                // An unterminated final record is still a record
+                if (!carry_.empty()) {
+                    record_ = carry_;
+                    record_in_carry_ = true;
+                } else {
+                    done_ = true;
+                }
+                return;
+            }
+        }
+    }
+
+public:
+    constexpr chunk_records_adaptor(decays_to<Base> auto&& base, char delim)
+        : base_(FLUX_FWD(base)),
+          delim_(delim)
+    {}
+
+    chunk_records_adaptor(chunk_records_adaptor&&) = default;
+    chunk_records_adaptor& operator=(chunk_records_adaptor&&) = default;
+
+    struct flux_sequence_traits {
+    private:
+        struct cursor_type {
+            cursor_type(cursor_type&&) = default;
+            cursor_type& operator=(cursor_type&&) = default;
+        private:
+            friend struct flux_sequence_traits;
+            constexpr cursor_type() = default;
+        };
+
+    public:
+        using value_type = std::string_view;
+
+        static constexpr auto first(chunk_records_adaptor& self) -> cursor_type
+        {
+            self.advance();
+            return cursor_type{};
+        }
+
+        static constexpr auto is_last(chunk_records_adaptor& self, cursor_type const&)
+            -> bool
+        {
+            return self.done_;
+        }
+
+        static constexpr auto read_at(chunk_records_adaptor& self, cursor_type const&)
+            -> std::string_view
+        {
+            return self.record_;
+        }
+
+        static constexpr auto inc(chunk_records_adaptor& self, cursor_type& cur)
+            -> cursor_type&
+        {
+            FLUX_DEBUG_ASSERT(!self.done_);
+            self.advance();
+            return cur;
+        }
+    };
+};
+
+struct chunk_records_fn {
+    template <adaptable_sequence Seq>
+        requires char_chunk<element_t<Seq>>
+    [[nodiscard]]
+    constexpr auto operator()(Seq&& seq, char delim = '\n') const
+    {
+        return chunk_records_adaptor<std::decay_t<Seq>>(FLUX_FWD(seq), delim);
+    }
+};
+
+} // namespace detail
+
+FLUX_EXPORT inline constexpr auto chunk_records = detail::chunk_records_fn{};
+
+template <typename D>
+constexpr auto inline_sequence_base<D>::chunk_records(char delim) &&
+{
+    return flux::chunk_records(std::move(derived()), delim);
+}
+
+} // namespace flux
+
+#endif // FLUX_OP_CHUNK_RECORDS_HPP_INCLUDED
@@ -38,12 +38,19 @@ struct count_eq_fn {
         -> distance_t
     {
         distance_t counter = 0;
-        flux::for_each_while(seq, [&](auto&& elem) {
-            if (value == FLUX_FWD(elem)) {
-                ++counter;
-            }
-            return true;
-        });
+        if constexpr (segmented_sequence<Seq>) {
+            flux::for_each_segment_while(seq, [&](auto& segment) {
+                counter += (*this)(segment, value);
+                return flux::size(segment);
+            });
+        } else {
+            flux::for_each_while(seq, [&](auto&& elem) {
+                if (value == FLUX_FWD(elem)) {
+                    ++counter;
+                }
+                return true;
+            });
+        }
         return counter;
     }
 };
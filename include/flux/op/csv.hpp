@@ -0,0 +1,446 @@
+
+// Copyright (c) 2023 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef FLUX_OP_CSV_HPP_INCLUDED
+#define FLUX_OP_CSV_HPP_INCLUDED
+
+#include <flux/core.hpp>
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace flux {
+
+FLUX_EXPORT
+struct csv_options {
+    char delimiter = ',';
+    char quote = '"';
+};
+
+/*
+ * A single record of a CSV file, which is a random-access sequence of its
+ * fields. Quoted fields have their enclosing quotes removed. Fields which
+ * contain doubled quotes are unescaped into a buffer owned by the record each
+ * time they are read; all other fields refer directly to the original text.
+ *
+ * Each field is unescaped to the same offset in the buffer as it has in the
+ * text, so reading it again rewrites the same characters, and views into the
+ * buffer stay valid for the lifetime of the record. Because reading a field
+ * writes to the buffer, a record must not be read from several threads at
+ * once without synchronisation.
+ */
+FLUX_EXPORT
+class csv_record : public inline_sequence_base<csv_record> {
+    // The field is escaped if len != raw_len
+    struct field_span {
+        std::uint32_t from;
+        std::uint32_t len;
+        std::uint32_t raw_len;
+    };
+
+    static constexpr std::size_t inline_capacity = 16;
+
+    std::string_view text_;
+    char quote_ = '"';
+    std::array<field_span, inline_capacity> inline_fields_;
+    std::vector<field_span> extra_fields_;
+    distance_t size_ = 0;
+    // Has the same size as text_, and is only allocated if some field needs
+    // unescaping
+    char* unescaped_ = nullptr;
+
+    constexpr auto push_field(field_span span) -> void
+    {
+        if (size_ < static_cast<distance_t>(inline_capacity)) {
+            inline_fields_[static_cast<std::size_t>(size_)] = span;
+        } else {
+            extra_fields_.push_back(span);
+        }
+        ++size_;
+    }
+
+    constexpr auto field_at(distance_t idx) const -> field_span const&
+    {
+        auto const i = static_cast<std::size_t>(idx);
+        return i < inline_capacity ? inline_fields_[i] : extra_fields_[i - inline_capacity];
+    }
+
+    static constexpr auto npos = std::string_view::npos;
+
+    static constexpr auto make_span(std::size_t from, std::size_t to, std::size_t n_escapes = 0)
+        -> field_span
+    {
+        return field_span{.from = static_cast<std::uint32_t>(from),
+                          .len = static_cast<std::uint32_t>(to - from - n_escapes),
+                          .raw_len = static_cast<std::uint32_t>(to - from)};
+    }
+
+    constexpr auto allocate_buffer() -> void
+    {
+        if (unescaped_ == nullptr) {
+            unescaped_ = std::allocator<char>{}.allocate(text_.size());
+        }
+    }
+
+    constexpr auto free_buffer() -> void
+    {
+        if (unescaped_ != nullptr) {
+            std::allocator<char>{}.deallocate(unescaped_, text_.size());
+            unescaped_ = nullptr;
+        }
+    }
+
+    // Copies an escaped field into its place in the buffer, replacing doubled
+    // quotes
+    constexpr auto unescape(field_span const& span) const -> std::string_view
+    {
+        char* const out = unescaped_ + span.from;
+        char const* const in = text_.data() + span.from;
+        std::size_t n = 0;
+        for (std::size_t i = 0; i < span.raw_len; ++i) {
+            out[n++] = in[i];
+            if (in[i] == quote_) {
+                ++i;
+            }
+        }
+        return std::string_view(out, n);
+    }
+
+public:
+    csv_record() = default;
+
+    constexpr csv_record(std::string_view text, csv_options const& opts)
+        : text_(text),
+          quote_(opts.quote)
+    {
+        if (text.size() > UINT32_MAX) {
+            runtime_error("flux::csv: record is too long");
+        }
+
+        // Spans beyond size_ are never read, so we only initialise them
+        // during constant evaluation, where that's required
+        if (std::is_constant_evaluated()) {
+            inline_fields_ = {};
+        }
+
+        std::size_t pos = 0;
+        while (true) {
+            std::size_t delim_pos;
+
+            if (pos < text.size() && text[pos] == opts.quote) {
+                std::size_t const content_from = pos + 1;
+                std::size_t search_from = content_from;
+                std::size_t content_to = text.size();
+                std::size_t n_escapes = 0;
+                std::size_t after = text.size();
+
+                while (true) {
+                    auto q = text.find(opts.quote, search_from);
+                    if (q == npos) {
+                        // Unterminated quote: take everything that's left
+                        break;
+                    }
+                    if (q + 1 < text.size() && text[q + 1] == opts.quote) {
+                        ++n_escapes;
+                        search_from = q + 2;
+                        continue;
+                    }
+                    content_to = q;
+                    after = q + 1;
+                    break;
+                }
+
+                if (n_escapes > 0) {
+                    allocate_buffer();
+                }
+                push_field(make_span(content_from, content_to, n_escapes));
+                // Anything between the closing quote and the next delimiter
+                // is malformed, and is ignored
+                delim_pos = text.find(opts.delimiter, after);
+            } else {
+                delim_pos = text.find(opts.delimiter, pos);
+                push_field(make_span(pos, delim_pos == npos ? text.size() : delim_pos));
+            }
+
+            if (delim_pos == npos) {
+                break;
+            }
+            pos = delim_pos + 1;
+        }
+    }
+
+    // Copies get a buffer of their own; it doesn't need to be filled, since
+    // fields are unescaped whenever they are read
+    constexpr csv_record(csv_record const& other)
+        : text_(other.text_),
+          quote_(other.quote_),
+          inline_fields_(other.inline_fields_),
+          extra_fields_(other.extra_fields_),
+          size_(other.size_)
+    {
+        if (other.unescaped_ != nullptr) {
+            allocate_buffer();
+        }
+    }
+
+    // Leaves `other` empty, as its fields may refer to the buffer we take
+    constexpr csv_record(csv_record&& other) noexcept
+        : text_(std::exchange(other.text_, {})),
+          quote_(other.quote_),
+          inline_fields_(other.inline_fields_),
+          extra_fields_(std::move(other.extra_fields_)),
+          size_(std::exchange(other.size_, 0)),
+          unescaped_(std::exchange(other.unescaped_, nullptr))
+    {}
+
+    constexpr auto operator=(csv_record other) noexcept -> csv_record&
+    {
+        std::swap(text_, other.text_);
+        std::swap(quote_, other.quote_);
+        std::swap(inline_fields_, other.inline_fields_);
+        std::swap(extra_fields_, other.extra_fields_);
+        std::swap(size_, other.size_);
+        std::swap(unescaped_, other.unescaped_);
+        return *this;
+    }
+
+    constexpr ~csv_record() { free_buffer(); }
+
+    // Returns the raw text of the record, without its line terminator
+    [[nodiscard]]
+    constexpr auto text() const -> std::string_view { return text_; }
+
+    struct flux_sequence_traits {
+        using value_type = std::string_view;
+
+        static constexpr auto first(csv_record const&) -> index_t { return 0; }
+
+        static constexpr auto is_last(csv_record const& self, index_t idx) -> bool
+        {
+            return idx >= self.size_;
+        }
+
+        static constexpr auto inc(csv_record const& self, index_t& idx) -> void
+        {
+            FLUX_DEBUG_ASSERT(idx < self.size_);
+            ++idx;
+        }
+
+        static constexpr auto read_at(csv_record const& self, index_t idx) -> std::string_view
+        {
+            indexed_bounds_check(idx, self.size_);
+            return read_at_unchecked(self, idx);
+        }
+
+        static constexpr auto read_at_unchecked(csv_record const& self, index_t idx)
+            -> std::string_view
+        {
+            auto const& span = self.field_at(idx);
+            if (span.len != span.raw_len) {
+                return self.unescape(span);
+            }
+            return std::string_view(self.text_.data() + span.from, span.len);
+        }
+
+        static constexpr auto dec(csv_record const&, index_t& idx) -> void
+        {
+            FLUX_DEBUG_ASSERT(idx > 0);
+            --idx;
+        }
+
+        static constexpr auto last(csv_record const& self) -> index_t { return self.size_; }
+
+        static constexpr auto inc(csv_record const& self, index_t& idx, distance_t offset)
+            -> void
+        {
+            index_t nxt = num::checked_add(idx, offset);
+            FLUX_DEBUG_ASSERT(nxt >= 0);
+            FLUX_DEBUG_ASSERT(nxt <= self.size_);
+            idx = nxt;
+        }
+
+        static constexpr auto distance(csv_record const&, index_t from, index_t to)
+            -> distance_t
+        {
+            return num::checked_sub(to, from);
+        }
+
+        static constexpr auto size(csv_record const& self) -> distance_t
+        {
+            return self.size_;
+        }
+
+        static constexpr auto for_each_while(csv_record const& self, auto&& pred) -> index_t
+        {
+            index_t idx = 0;
+            for (; idx < self.size_; idx++) {
+                if (!std::invoke(pred, read_at_unchecked(self, idx))) {
+                    break;
+                }
+            }
+            return idx;
+        }
+    };
+};
+
+namespace detail {
+
+template <contiguous_sequence Base>
+    requires sized_sequence<Base> && std::same_as<value_t<Base>, char>
+struct csv_adaptor : inline_sequence_base<csv_adaptor<Base>> {
+private:
+    FLUX_NO_UNIQUE_ADDRESS Base base_;
+    csv_options opts_;
+
+public:
+    constexpr csv_adaptor(decays_to<Base> auto&& base, csv_options const& opts)
+        : base_(FLUX_FWD(base)),
+          opts_(opts)
+    {}
+
+    struct flux_sequence_traits {
+    private:
+        // [from, to) is the text of the current record, and `next` is the
+        // start of the following one. `next_quote` caches the position of the
+        // first quote at or after `from`, so that runs of records without any
+        // quotes are skipped with a single search.
+        struct cursor_type {
+            distance_t from = 0;
+            distance_t to = 0;
+            distance_t next = 0;
+            distance_t next_quote = 0;
+
+            friend constexpr auto operator==(cursor_type const& lhs, cursor_type const& rhs)
+                -> bool
+            {
+                return lhs.from == rhs.from;
+            }
+        };
+
+        static constexpr auto text(auto& self) -> std::string_view
+        {
+            return std::string_view(flux::data(self.base_),
+                                    static_cast<std::size_t>(flux::size(self.base_)));
+        }
+
+        static constexpr auto find_or_end(std::string_view txt, char c, std::size_t pos)
+            -> std::size_t
+        {
+            auto res = txt.find(c, pos);
+            return res == std::string_view::npos ? txt.size() : res;
+        }
+
+        // Finds the newline which ends a record starting at `from` which
+        // contains quotes, by hopping from quote to quote and skipping any
+        // newlines inside quoted fields. As in csv_record, only a quote at the
+        // start of a field opens a quoted field.
+        static constexpr auto find_quoted_record_end(std::string_view txt, std::size_t from,
+                                                     std::size_t quote_pos,
+                                                     csv_options const& opts) -> std::size_t
+        {
+            auto line_end = find_or_end(txt, '\n', from);
+            auto pos = quote_pos;
+
+            while (pos < line_end) {
+                if (pos == from || txt[pos - 1] == opts.delimiter) {
+                    auto close = find_or_end(txt, opts.quote, pos + 1);
+                    while (close + 1 < txt.size() && txt[close + 1] == opts.quote) {
+                        close = find_or_end(txt, opts.quote, close + 2);
+                    }
+                    if (close == txt.size()) {
+                        return close;
+                    }
+                    line_end = find_or_end(txt, '\n', close + 1);
+                    pos = close;
+                }
+                pos = find_or_end(txt.substr(0, line_end), opts.quote, pos + 1);
+            }
+
+            return line_end;
+        }
+
+        static constexpr auto make_cursor(auto& self, distance_t from, distance_t next_quote)
+            -> cursor_type
+        {
+            auto const txt = text(self);
+            auto const ufrom = static_cast<std::size_t>(from);
+
+            if (next_quote < from) {
+                next_quote = static_cast<distance_t>(find_or_end(txt, self.opts_.quote, ufrom));
+            }
+
+            auto end = find_or_end(txt, '\n', ufrom);
+            if (static_cast<std::size_t>(next_quote) < end) {
+                end = find_quoted_record_end(txt, ufrom, static_cast<std::size_t>(next_quote),
+                                             self.opts_);
+            }
+
+            auto to = end;
+            if (to > ufrom && txt[to - 1] == '\r') {
+                --to;
+            }
+            auto const next = end < txt.size() ? end + 1 : end;
+            return cursor_type{.from = from,
+                               .to = static_cast<distance_t>(to),
+                               .next = static_cast<distance_t>(next),
+                               .next_quote = next_quote};
+        }
+
+    public:
+        using value_type = csv_record;
+
+        static constexpr auto first(auto& self) -> cursor_type
+        {
+            return make_cursor(self, 0, -1);
+        }
+
+        static constexpr auto is_last(auto& self, cursor_type const& cur) -> bool
+        {
+            return cur.from >= flux::size(self.base_);
+        }
+
+        static constexpr auto inc(auto& self, cursor_type& cur) -> void
+        {
+            FLUX_DEBUG_ASSERT(!is_last(self, cur));
+            cur = make_cursor(self, cur.next, cur.next_quote);
+        }
+
+        static constexpr auto read_at(auto& self, cursor_type const& cur) -> csv_record
+        {
+            return csv_record(text(self).substr(static_cast<std::size_t>(cur.from),
+                                                static_cast<std::size_t>(cur.to - cur.from)),
+                              self.opts_);
+        }
+
+        static constexpr auto last(auto& self) -> cursor_type
+        {
+            auto const sz = flux::size(self.base_);
+            return cursor_type{.from = sz, .to = sz, .next = sz, .next_quote = sz};
+        }
+    };
+};
+
+struct csv_fn {
+    template <adaptable_sequence Seq>
+        requires contiguous_sequence<Seq> && sized_sequence<Seq> &&
+                 std::same_as<value_t<Seq>, char>
+    [[nodiscard]]
+    constexpr auto operator()(Seq&& seq, csv_options const& opts = {}) const
+    {
+        return csv_adaptor<std::decay_t<Seq>>(FLUX_FWD(seq), opts);
+    }
+};
+
+} // namespace detail
+
+FLUX_EXPORT inline constexpr auto csv = detail::csv_fn{};
+
+} // namespace flux
+
+#endif // FLUX_OP_CSV_HPP_INCLUDED
@@ -77,6 +77,11 @@ public:
         {
             return flux::size(self.base_);
         }
+
+        static constexpr auto size_hint(auto& self) -> size_bounds
+        {
+            return flux::size_hint(self.base_);
+        }
     };
 };
 
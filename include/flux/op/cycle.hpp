@@ -206,6 +206,14 @@ public:
             return num::checked_mul(flux::size(self.base_),
                                     checked_cast<flux::distance_t>(self.data_.count));
         }
+
+        static constexpr auto size_hint(auto& self) -> size_bounds
+            requires (!IsInfinite)
+        {
+            return detail::size_bounds_mul(
+                flux::size_hint(self.base_),
+                detail::exact_size_bounds(checked_cast<flux::distance_t>(self.data_.count)));
+        }
     };
 };
 
@@ -7,6 +7,7 @@
 #define FLUX_OP_DROP_HPP_INCLUDED
 
 #include <flux/core.hpp>
+#include <flux/op/for_each_while.hpp>
 #include <flux/op/from.hpp>
 #include <flux/op/stride.hpp>
 
@@ -48,13 +49,32 @@ public:
                               distance_t{0});
         }
 
+        static constexpr auto size_hint(auto& self) -> size_bounds
+        {
+            auto bounds = flux::size_hint(self.base_);
+            auto sub = [&](distance_t n) { return (cmp::max)(n - self.count_, distance_t{0}); };
+            return {sub(bounds.lower), bounds.upper.map(sub)};
+        }
+
         static constexpr auto data(auto& self)
             requires contiguous_sequence<Base> && sized_sequence<Base>
         {
             return flux::data(self.base()) + (cmp::min)(self.count_, flux::size(self.base_));
         }
 
-        void for_each_while(...) = delete;
+        static constexpr auto for_each_while(auto& self, auto&& pred) -> cursor_t<Base>
+        {
+            if constexpr (multipass_sequence<Base>) {
+                return detail::for_each_while_from(self.base_, first(self), std::ref(pred));
+            } else {
+                // Stepping over the dropped elements of a single-pass
+                // sequence consumes them anyway, so we may as well stay on
+                // the base's internal iteration path while doing so
+                distance_t skip = self.count_;
+                return detail::for_each_while_strided(self.base_, std::ref(pred),
+                                                      distance_t{1}, skip);
+            }
+        }
     };
 };
 
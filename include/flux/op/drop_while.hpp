@@ -49,6 +49,11 @@ public:
 
         void size(...) = delete;
         void for_each_while(...) = delete;
+
+        static constexpr auto size_hint(auto& self) -> size_bounds
+        {
+            return detail::size_bounds_at_most(flux::size_hint(self.base_));
+        }
     };
 };
 
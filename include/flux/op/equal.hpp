@@ -7,8 +7,10 @@
 #define FLUX_OP_EQUAL_HPP_INCLUDED
 
 #include <flux/core.hpp>
+#include <flux/op/for_each_while.hpp>
 #include <type_traits>
 #include <cstring>
+#include <span>
 
 namespace flux {
 
@@ -33,6 +35,40 @@ private:
         return flux::is_last(seq1, cur1) == flux::is_last(seq2, cur2);
     }
 
+    // Compares each segment of `segmented` with the corresponding part of
+    // `contig`, so that each comparison can use the contiguous fast path.
+    // If Flip is true, `contig` was originally the first argument.
+    template <bool Flip, typename Seg, typename Contig, typename Cmp>
+    constexpr auto segmented_impl(Seg& segmented, Contig& contig, Cmp& cmp) const
+        -> bool
+    {
+        auto* const data = flux::data(contig);
+        distance_t const size = flux::size(contig);
+        distance_t offset = 0;
+        bool result = true;
+
+        flux::for_each_segment_while(segmented, [&](auto& segment) -> distance_t {
+            distance_t const n = flux::size(segment);
+            if (n > size - offset) {
+                result = false;
+                return 0;
+            }
+            auto part = std::span(data + offset, static_cast<std::size_t>(n));
+            if constexpr (Flip) {
+                result = (*this)(part, segment, cmp);
+            } else {
+                result = (*this)(segment, part, cmp);
+            }
+            if (!result) {
+                return 0;
+            }
+            offset += n;
+            return n;
+        });
+
+        return result && offset == size;
+    }
+
 public:
     template <sequence Seq1, sequence Seq2, typename Cmp = std::ranges::equal_to>
         requires std::predicate<Cmp&, element_t<Seq1>, element_t<Seq2>>
@@ -70,6 +106,12 @@ public:
                 auto result = std::memcmp(data1, data2, size * sizeof(value_t<Seq1>));
                 return result == 0;
             }
+        } else if constexpr (segmented_sequence<Seq1> &&
+                             contiguous_sequence<Seq2> && sized_sequence<Seq2>) {
+            return segmented_impl<false>(seq1, seq2, cmp);
+        } else if constexpr (contiguous_sequence<Seq1> && sized_sequence<Seq1> &&
+                             segmented_sequence<Seq2>) {
+            return segmented_impl<true>(seq2, seq1, cmp);
         } else {
             return impl(seq1, seq2, cmp);
         }
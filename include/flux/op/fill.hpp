@@ -47,6 +47,11 @@ public:
                 std::memset(flux::data(seq), value,
                     size * sizeof(value_t<Seq>));
             }
+        } else if constexpr (segmented_sequence<Seq>) {
+            flux::for_each_segment_while(seq, [&](auto& segment) {
+                (*this)(segment, value);
+                return flux::size(segment);
+            });
         } else {
             impl(seq, value);
         }
@@ -102,6 +102,11 @@ public:
             return cursor_type{flux::last(self.base_)};
         }
 
+        static constexpr auto size_hint(auto& self) -> size_bounds
+        {
+            return detail::size_bounds_at_most(flux::size_hint(self.base_));
+        }
+
         static constexpr auto for_each_while(auto& self, auto&& func)
             -> cursor_type
         {
@@ -113,6 +118,40 @@ public:
                 }
             })};
         }
+
+        static constexpr auto for_each_while_from(auto& self, cursor_type from, auto&& func)
+            -> cursor_type
+        {
+            return cursor_type{flux::detail::for_each_while_from(self.base_, std::move(from).base_cur,
+                                                                [&](auto&& elem) {
+                if (std::invoke(self.pred_, elem)) {
+                    return std::invoke(func, FLUX_FWD(elem));
+                } else {
+                    return true;
+                }
+            })};
+        }
+
+        // Every base element needs to be read to test it against the
+        // predicate, but we don't pass on the ones we step over
+        static constexpr auto for_each_while_strided(auto& self, auto&& func,
+                                                     distance_t stride, distance_t& skip)
+            -> cursor_type
+        {
+            return cursor_type{flux::for_each_while(self.base_, [&](auto&& elem) {
+                if (!std::invoke(self.pred_, elem)) {
+                    return true;
+                } else if (skip > 0) {
+                    --skip;
+                    return true;
+                } else if (std::invoke(func, FLUX_FWD(elem))) {
+                    skip = stride - 1;
+                    return true;
+                } else {
+                    return false;
+                }
+            })};
+        }
     };
 };
 
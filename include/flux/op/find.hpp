@@ -54,6 +54,11 @@ public:
                     return flux::next(seq, flux::first(seq), offset);
                 }
             }
+        } else if constexpr (segmented_sequence<Seq>) {
+            return flux::for_each_segment_while(seq, [&](auto& segment) {
+                return flux::distance(segment, flux::first(segment),
+                                      (*this)(segment, value));
+            });
         } else {
             return impl(seq, value);
         }
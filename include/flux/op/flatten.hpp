@@ -7,6 +7,7 @@
 #define FLUX_OP_FLATTEN_HPP_INCLUDED
 
 #include <flux/core.hpp>
+#include <flux/op/for_each_while.hpp>
 
 namespace flux {
 
@@ -195,6 +196,90 @@ public:
                                .inner_cur = std::move(inner_cur)};
         }
 
+        template <typename Self>
+            requires can_flatten<Self>
+        static constexpr auto for_each_while_from(Self& self, cursor_type from, auto&& pred)
+            -> cursor_type
+        {
+            if (flux::is_last(self.base_, from.outer_cur)) {
+                return from;
+            }
+
+            // Finish off the inner sequence we're part-way through...
+            {
+                auto&& inner = flux::read_at(self.base_, from.outer_cur);
+                from.inner_cur = detail::for_each_while_from(inner, std::move(from.inner_cur),
+                                                             std::ref(pred));
+                if (!flux::is_last(inner, from.inner_cur)) {
+                    return from;
+                }
+            }
+
+            // ...and then iterate over the rest as normal
+            flux::inc(self.base_, from.outer_cur);
+            auto inner_cur = cursor_t<InnerSeq>{};
+            auto outer_cur = detail::for_each_while_from(self.base_, std::move(from.outer_cur),
+                                                         [&](auto&& inner_seq) {
+                inner_cur = flux::for_each_while(inner_seq, std::ref(pred));
+                return flux::is_last(inner_seq, inner_cur);
+            });
+            if (flux::is_last(self.base_, outer_cur)) {
+                inner_cur = cursor_t<InnerSeq>{};
+            }
+            return cursor_type{.outer_cur = std::move(outer_cur),
+                               .inner_cur = std::move(inner_cur)};
+        }
+
+        template <typename Self>
+            requires can_flatten<Self>
+        static constexpr auto for_each_while_strided(Self& self, auto&& pred,
+                                                     distance_t stride, distance_t& skip)
+            -> cursor_type
+        {
+            auto inner_cur = cursor_t<InnerSeq>{};
+            auto outer_cur = flux::for_each_while(self.base_, [&](auto&& inner_seq) {
+                inner_cur = detail::for_each_while_strided(inner_seq, std::ref(pred), stride, skip);
+                return flux::is_last(inner_seq, inner_cur);
+            });
+            return cursor_type{.outer_cur = std::move(outer_cur),
+                               .inner_cur = std::move(inner_cur)};
+        }
+
+        // Summing the inner sizes takes a pass over the outer sequence, so
+        // we report an exact size hint rather than being a sized_sequence
+        template <typename Self>
+            requires can_flatten<Self> && sized_sequence<InnerSeq>
+        static constexpr auto size_hint(Self& self) -> size_bounds
+        {
+            distance_t total = 0;
+            flux::for_each_while(self.base_, [&total](auto&& inner) {
+                total = num::checked_add(total, flux::size(inner));
+                return true;
+            });
+            return exact_size_bounds(total);
+        }
+
+        // When the inner sequences are contiguous, each one is a segment
+        template <typename Self>
+            requires can_flatten<Self> &&
+                     contiguous_sequence<InnerSeq> &&
+                     sized_sequence<InnerSeq>
+        static constexpr auto for_each_segment_while(Self& self, auto&& pred)
+            -> cursor_type
+        {
+            auto inner_cur = cursor_t<InnerSeq>{};
+            auto outer_cur = flux::for_each_while(self.base_, [&](auto&& inner) {
+                distance_t const n = std::invoke(pred, inner);
+                if (n < flux::size(inner)) {
+                    inner_cur = flux::next(inner, flux::first(inner), n);
+                    return false;
+                }
+                return true;
+            });
+            return cursor_type{.outer_cur = std::move(outer_cur),
+                               .inner_cur = std::move(inner_cur)};
+        }
+
         template <typename Self>
             requires can_flatten<Self> && bounded_sequence<Base>
         static constexpr auto last(Self& self) -> cursor_type
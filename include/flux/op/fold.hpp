@@ -25,10 +25,18 @@ struct fold_op {
     constexpr auto operator()(Seq&& seq, Func func, Init init = Init{}) const -> R
     {
         R init_ = R(std::move(init));
-        flux::for_each_while(seq, [&func, &init_](auto&& elem) {
-            init_ = std::invoke(func, std::move(init_), FLUX_FWD(elem));
-            return true;
-        });
+        if constexpr (segmented_sequence<Seq>) {
+            // Folding each segment in turn gives a tight loop per segment
+            flux::for_each_segment_while(seq, [&](auto& segment) {
+                init_ = (*this)(segment, std::ref(func), std::move(init_));
+                return flux::size(segment);
+            });
+        } else {
+            flux::for_each_while(seq, [&func, &init_](auto&& elem) {
+                init_ = std::invoke(func, std::move(init_), FLUX_FWD(elem));
+                return true;
+            });
+        }
         return init_;
     }
 };
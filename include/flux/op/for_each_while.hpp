@@ -41,9 +41,143 @@ struct for_each_while_fn {
     }
 };
 
+/*
+ * Internal iteration starting from a cursor
+ *
+ * Like for_each_while(), but begins at the element pointed to by `from`
+ * rather than at the start of the sequence. This allows adaptors such as
+ * drop() and slice() to keep the internal iteration fast paths of their
+ * bases. Sequences can customise it by providing a
+ * for_each_while_from(self, from, pred) traits function.
+ */
+struct for_each_while_from_fn {
+    template <sequence Seq, typename Pred>
+        requires std::invocable<Pred&, element_t<Seq>> &&
+                 boolean_testable<std::invoke_result_t<Pred&, element_t<Seq>>>
+    constexpr auto operator()(Seq&& seq, cursor_t<Seq> from, Pred pred) const
+        -> cursor_t<Seq>
+    {
+        if constexpr (requires { traits_t<Seq>::for_each_while_from(seq, std::move(from), std::move(pred)); }) {
+            return traits_t<Seq>::for_each_while_from(seq, std::move(from), std::move(pred));
+        } else {
+            if constexpr (multipass_sequence<Seq> && bounded_sequence<Seq>) {
+                auto end = last(seq);
+                while (from != end) {
+                    if (!std::invoke(pred, read_at(seq, from))) { break; }
+                    inc(seq, from);
+                }
+                return from;
+            } else {
+                while (!is_last(seq, from)) {
+                    if (!std::invoke(pred, read_at(seq, from))) { break; }
+                    inc(seq, from);
+                }
+                return from;
+            }
+        }
+    }
+};
+
+inline constexpr auto for_each_while_from = for_each_while_from_fn{};
+
+/*
+ * Strided internal iteration
+ *
+ * Calls pred with every `stride`-th element of the sequence, after first
+ * stepping over `skip` elements. On return, `skip` holds the number of
+ * elements which still need to be stepped over before the next element
+ * would be visited, so that iteration can be resumed in a following sequence
+ * (as required by chain() and flatten()).
+ *
+ * Sequences can customise this by providing a
+ * for_each_while_strided(self, pred, stride, skip) traits function, which
+ * should avoid reading elements which are stepped over.
+ */
+struct for_each_while_strided_fn {
+    template <sequence Seq, typename Pred>
+        requires std::invocable<Pred&, element_t<Seq>> &&
+                 boolean_testable<std::invoke_result_t<Pred&, element_t<Seq>>>
+    constexpr auto operator()(Seq&& seq, Pred pred, distance_t stride,
+                              distance_t& skip) const -> cursor_t<Seq>
+    {
+        FLUX_DEBUG_ASSERT(stride > 0);
+        FLUX_DEBUG_ASSERT(skip >= 0);
+
+        if constexpr (requires { traits_t<Seq>::for_each_while_strided(seq, std::move(pred), stride, skip); }) {
+            return traits_t<Seq>::for_each_while_strided(seq, std::move(pred), stride, skip);
+        } else if constexpr (random_access_sequence<Seq> && bounded_sequence<Seq>) {
+            auto cur = first(seq);
+            auto const end = last(seq);
+            distance_t rem = distance(seq, cur, end);
+            if (skip >= rem) {
+                skip -= rem;
+                return end;
+            }
+            inc(seq, cur, skip);
+            rem -= skip;
+            skip = 0;
+            while (std::invoke(pred, read_at_unchecked(seq, cur))) {
+                if (rem <= stride) {
+                    skip = stride - rem;
+                    return end;
+                }
+                inc(seq, cur, stride);
+                rem -= stride;
+            }
+            return cur;
+        } else if constexpr (requires { traits_t<Seq>::for_each_while(seq, pred); }) {
+            // We can't step over elements without losing the custom
+            // for_each_while(), so we need to read and discard them instead
+            return for_each_while_fn{}(seq, [&](auto&& elem) {
+                if (skip > 0) {
+                    --skip;
+                    return true;
+                } else if (std::invoke(pred, FLUX_FWD(elem))) {
+                    skip = stride - 1;
+                    return true;
+                } else {
+                    return false;
+                }
+            });
+        } else {
+            auto cur = first(seq);
+            while (!is_last(seq, cur)) {
+                if (skip > 0) {
+                    --skip;
+                } else if (std::invoke(pred, read_at(seq, cur))) {
+                    skip = stride - 1;
+                } else {
+                    break;
+                }
+                inc(seq, cur);
+            }
+            return cur;
+        }
+    }
+};
+
+inline constexpr auto for_each_while_strided = for_each_while_strided_fn{};
+
+/*
+ * Segment-wise internal iteration
+ *
+ * Calls `pred` with each contiguous segment of a segmented sequence in turn.
+ * `pred` returns the offset within the segment of the element at which to
+ * stop, or the size of the segment to carry on to the next one. Returns a
+ * cursor to the element at which iteration stopped, or the end cursor.
+ */
+struct for_each_segment_while_fn {
+    template <segmented_sequence Seq, typename Pred>
+    constexpr auto operator()(Seq&& seq, Pred pred) const -> cursor_t<Seq>
+    {
+        return traits_t<Seq>::for_each_segment_while(seq, pred);
+    }
+};
+
 } // namespace detail
 
 FLUX_EXPORT inline constexpr auto for_each_while = detail::for_each_while_fn{};
+FLUX_EXPORT inline constexpr auto for_each_segment_while = detail::for_each_segment_while_fn{};
 
 template <typename Derived>
 template <typename Pred>
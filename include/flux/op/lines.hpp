@@ -0,0 +1,161 @@
+
+// Copyright (c) 2023 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef FLUX_OP_LINES_HPP_INCLUDED
+#define FLUX_OP_LINES_HPP_INCLUDED
+
+#include <flux/core.hpp>
+
+#include <string>
+#include <string_view>
+
+namespace flux {
+
+namespace detail {
+
+template <contiguous_sequence Base>
+    requires sized_sequence<Base> && character<value_t<Base>>
+struct lines_adaptor : inline_sequence_base<lines_adaptor<Base>> {
+private:
+    using char_type = value_t<Base>;
+    using traits_type = std::char_traits<char_type>;
+
+    FLUX_NO_UNIQUE_ADDRESS Base base_;
+    bool strip_cr_;
+
+public:
+    constexpr lines_adaptor(decays_to<Base> auto&& base, bool strip_cr)
+        : base_(FLUX_FWD(base)),
+          strip_cr_(strip_cr)
+    {}
+
+    struct flux_sequence_traits {
+    private:
+        // [from, to) is the current line, not including the terminator
+        struct cursor_type {
+            distance_t from = 0;
+            distance_t to = 0;
+
+            friend constexpr auto operator==(cursor_type const& lhs, cursor_type const& rhs)
+                -> bool
+            {
+                return lhs.from == rhs.from;
+            }
+        };
+
+        static constexpr char_type newline = char_type('\n');
+
+        // Returns the position of the next newline at or after `pos`, or the
+        // size of the base if there isn't one. For char this is memchr().
+        static constexpr auto find_newline(auto& self, distance_t pos) -> distance_t
+        {
+            auto const sz = flux::size(self.base_);
+            if (pos >= sz) {
+                return sz;
+            }
+            auto const* data = flux::data(self.base_);
+            auto const* ptr = traits_type::find(data + pos,
+                                                static_cast<std::size_t>(sz - pos),
+                                                newline);
+            return ptr == nullptr ? sz : static_cast<distance_t>(ptr - data);
+        }
+
+        static constexpr auto make_cursor(auto& self, distance_t from) -> cursor_type
+        {
+            return cursor_type{.from = from, .to = find_newline(self, from)};
+        }
+
+    public:
+        using value_type = std::basic_string_view<char_type>;
+
+        static constexpr auto first(auto& self) -> cursor_type
+        {
+            return make_cursor(self, 0);
+        }
+
+        static constexpr auto is_last(auto& self, cursor_type const& cur) -> bool
+        {
+            return cur.from >= flux::size(self.base_);
+        }
+
+        static constexpr auto inc(auto& self, cursor_type& cur) -> void
+        {
+            FLUX_DEBUG_ASSERT(!is_last(self, cur));
+            // If the last line has no terminator then we step to the end
+            auto const sz = flux::size(self.base_);
+            cur = make_cursor(self, cur.to < sz ? cur.to + 1 : sz);
+        }
+
+        static constexpr auto read_at(auto& self, cursor_type const& cur)
+            -> std::basic_string_view<char_type>
+        {
+            auto const* data = flux::data(self.base_);
+            distance_t to = cur.to;
+            if (self.strip_cr_ && to > cur.from && data[to - 1] == char_type('\r')) {
+                --to;
+            }
+            return std::basic_string_view<char_type>(
+                data + cur.from, static_cast<std::size_t>(to - cur.from));
+        }
+
+        static constexpr auto dec(auto& self, cursor_type& cur) -> void
+        {
+            FLUX_DEBUG_ASSERT(cur.from > 0);
+            auto const* data = flux::data(self.base_);
+            auto const sz = flux::size(self.base_);
+
+            // The previous line ends at the terminator just before us, unless
+            // we're at the end and the final line was unterminated
+            distance_t to = cur.from - 1;
+            if (cur.from == sz && data[sz - 1] != newline) {
+                to = sz;
+            }
+
+            distance_t from = to;
+            while (from > 0 && data[from - 1] != newline) {
+                --from;
+            }
+            cur = cursor_type{.from = from, .to = to};
+        }
+
+        static constexpr auto last(auto& self) -> cursor_type
+        {
+            auto const sz = flux::size(self.base_);
+            return cursor_type{.from = sz, .to = sz};
+        }
+
+        // A non-empty buffer has at least one line, and at most one per character
+        static constexpr auto size_hint(auto& self) -> size_bounds
+        {
+            auto const sz = flux::size(self.base_);
+            return {(cmp::min)(sz, distance_t{1}), flux::optional<distance_t>(sz)};
+        }
+    };
+};
+
+struct lines_fn {
+    template <adaptable_sequence Seq>
+        requires contiguous_sequence<Seq> && sized_sequence<Seq> &&
+                 character<value_t<Seq>>
+    [[nodiscard]]
+    constexpr auto operator()(Seq&& seq, bool strip_cr = false) const
+    {
+        return lines_adaptor<std::decay_t<Seq>>(FLUX_FWD(seq), strip_cr);
+    }
+};
+
+} // namespace detail
+
+FLUX_EXPORT inline constexpr auto lines = detail::lines_fn{};
+
+template <typename D>
+constexpr auto inline_sequence_base<D>::lines(bool strip_cr) &&
+{
+    return flux::lines(std::move(derived()), strip_cr);
+}
+
+} // namespace flux
+
+#endif // FLUX_OP_LINES_HPP_INCLUDED
@@ -35,6 +35,9 @@ public:
     constexpr auto base() && -> Base&& { return std::move(base_); }
     constexpr auto base() const&& -> Base const&& { return std::move(base_); }
 
+    constexpr auto func() & -> Func& { return func_; }
+    constexpr auto func() const& -> Func const& { return func_; }
+
     struct flux_sequence_traits  : detail::passthrough_traits_base<Base>
     {
         using value_type = std::remove_cvref_t<std::invoke_result_t<Func&, element_t<Base>>>;
@@ -63,11 +66,32 @@ public:
             });
         }
 
+        static constexpr auto for_each_while_from(auto& self, auto&& from, auto&& pred)
+        {
+            return detail::for_each_while_from(self.base_, FLUX_FWD(from), [&](auto&& elem) {
+                return std::invoke(pred, std::invoke(self.func_, FLUX_FWD(elem)));
+            });
+        }
+
+        static constexpr auto for_each_while_strided(auto& self, auto&& pred,
+                                                     distance_t stride, distance_t& skip)
+        {
+            return detail::for_each_while_strided(self.base_, [&](auto&& elem) {
+                return std::invoke(pred, std::invoke(self.func_, FLUX_FWD(elem)));
+            }, stride, skip);
+        }
+
         static void move_at() = delete; // Use the base version of move_at
         static void data() = delete; // we're not a contiguous sequence
     };
 };
 
+template <typename>
+inline constexpr bool is_map_adaptor = false;
+
+template <typename Base, typename Func>
+inline constexpr bool is_map_adaptor<map_adaptor<Base, Func>> = true;
+
 struct map_fn {
     template <adaptable_sequence Seq, typename Func>
         requires std::regular_invocable<Func&, element_t<Seq>>
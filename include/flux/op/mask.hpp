@@ -137,6 +137,15 @@ public:
                 flux::dec(self.mask_, cur.mask_cur);
             } while (!static_cast<bool>(flux::read_at(self.mask_, cur.mask_cur)));
         }
+
+        template <typename Self>
+            requires maybe_const_iterable<Self>
+        static constexpr auto size_hint(Self& self) -> size_bounds
+        {
+            return detail::size_bounds_at_most(
+                detail::size_bounds_min(flux::size_hint(self.base_),
+                                        flux::size_hint(self.mask_)));
+        }
     };
 };
 
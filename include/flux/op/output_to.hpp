@@ -8,6 +8,7 @@
 
 #include <flux/op/for_each.hpp>
 
+#include <algorithm>
 #include <cstring>
 #include <iterator>
 
@@ -15,6 +16,62 @@ namespace flux {
 
 namespace detail {
 
+template <typename C>
+concept hint_reservable_container =
+    requires (C& c, typename C::size_type sz) {
+        c.reserve(sz);
+        { c.size() } -> std::same_as<typename C::size_type>;
+        { c.capacity() } -> std::same_as<typename C::size_type>;
+        { c.max_size() } -> std::same_as<typename C::size_type>;
+    };
+
+/*
+ * Makes room for `hint.lower` more elements, or for exactly the number of
+ * elements when the bounds agree. We never reserve a loose upper bound: a
+ * sparse filter over a huge base would otherwise allocate (and, for
+ * output_to(), keep) room for every element of the base. Growth stays
+ * geometric, so that repeatedly appending a few elements to the same
+ * container doesn't reallocate every time.
+ */
+template <hint_reservable_container C>
+constexpr void reserve_for_hint(C& c, size_bounds const& hint)
+{
+    using size_type = typename C::size_type;
+
+    distance_t const n = hint.upper.has_value() && *hint.upper == hint.lower
+                             ? *hint.upper : hint.lower;
+    if (n <= 0) {
+        return;
+    }
+    size_type const room = c.max_size() - c.size();
+    size_type const extra = static_cast<std::make_unsigned_t<distance_t>>(n) < room
+                                ? static_cast<size_type>(n) : room;
+    if (c.size() + extra > c.capacity()) {
+        c.reserve((std::max)(c.size() + extra, (std::min)(c.capacity() * 2, c.max_size())));
+    }
+}
+
+// The back_insert_iterator's container is a protected member
+template <typename C>
+struct back_insert_access : std::back_insert_iterator<C> {
+    static constexpr auto get(std::back_insert_iterator<C> const& iter) -> C&
+    {
+        return *(iter.*(&back_insert_access::container));
+    }
+};
+
+template <typename Iter>
+inline constexpr bool is_back_inserter = false;
+
+template <typename C>
+inline constexpr bool is_back_inserter<std::back_insert_iterator<C>> = true;
+
+template <typename Iter>
+inline constexpr bool is_reservable_back_inserter = false;
+
+template <hint_reservable_container C>
+inline constexpr bool is_reservable_back_inserter<std::back_insert_iterator<C>> = true;
+
 struct output_to_fn {
 private:
     template <typename Seq, typename Iter>
@@ -27,18 +84,28 @@ private:
         return iter;
     }
 
+    template <typename Seq, typename Iter>
+    static constexpr bool can_memcpy =
+        contiguous_sequence<Seq> &&
+        sized_sequence<Seq> &&
+        std::contiguous_iterator<Iter> &&
+        std::is_trivially_copyable_v<value_t<Seq>>;
+
+    template <typename Seq, typename Iter>
+    static constexpr bool can_range_insert =
+        contiguous_sequence<Seq> &&
+        sized_sequence<Seq> &&
+        is_back_inserter<Iter> &&
+        requires (typename Iter::container_type& c, Seq& seq) {
+            c.insert(c.end(), flux::data(seq), flux::data(seq));
+        };
+
 public:
-    template <sequence Seq, std::weakly_incrementable Iter>
-        requires std::indirectly_writable<Iter, element_t<Seq>>
-    constexpr auto operator()(Seq&& seq, Iter iter) const -> Iter
+    // Writes the elements of seq through iter, without reserving space
+    template <typename Seq, typename Iter>
+    static constexpr auto write(Seq& seq, Iter iter) -> Iter
     {
-        constexpr bool can_memcpy =
-            contiguous_sequence<Seq> &&
-            sized_sequence<Seq> &&
-            std::contiguous_iterator<Iter> &&
-            std::is_trivially_copyable_v<value_t<Seq>>;
-
-        if constexpr (can_memcpy) {
+        if constexpr (can_memcpy<Seq, Iter>) {
             if (std::is_constant_evaluated()) {
                 return impl(seq, iter);
             } else {
@@ -51,10 +118,33 @@ public:
                              size * sizeof(value_t<Seq>));
                 return iter + checked_cast<std::iter_difference_t<Iter>>(flux::size(seq));
             }
+        } else if constexpr (can_range_insert<Seq, Iter>) {
+            auto& c = back_insert_access<typename Iter::container_type>::get(iter);
+            auto* ptr = flux::data(seq);
+            c.insert(c.end(), ptr, ptr + flux::size(seq));
+            return iter;
+        } else if constexpr (segmented_sequence<Seq> &&
+                             (std::contiguous_iterator<Iter> || is_back_inserter<Iter>)) {
+            flux::for_each_segment_while(seq, [&iter](auto& segment) {
+                iter = write(segment, std::move(iter));
+                return flux::size(segment);
+            });
+            return iter;
         } else {
             return impl(seq, iter);
         }
     }
+
+    template <sequence Seq, std::weakly_incrementable Iter>
+        requires std::indirectly_writable<Iter, element_t<Seq>>
+    constexpr auto operator()(Seq&& seq, Iter iter) const -> Iter
+    {
+        if constexpr (is_reservable_back_inserter<Iter>) {
+            using C = typename Iter::container_type;
+            reserve_for_hint(back_insert_access<C>::get(iter), flux::size_hint(seq));
+        }
+        return write(seq, std::move(iter));
+    }
 };
 
 }
@@ -0,0 +1,134 @@
+
+// Copyright (c) 2023 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef FLUX_OP_PAR_TEXT_CHUNKS_HPP_INCLUDED
+#define FLUX_OP_PAR_TEXT_CHUNKS_HPP_INCLUDED
+
+#include <flux/core.hpp>
+
+#include <exception>
+#include <optional>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace flux {
+
+namespace detail {
+
+/*
+ * Splits `text` into at most `n_parts` pieces of roughly equal size, moving
+ * each split point forward so that it falls just after a delimiter. Every
+ * piece therefore consists of complete records, except that the last may end
+ * with an unterminated one. Empty pieces are dropped.
+ */
+inline auto split_at_records(std::string_view text, char delim, distance_t n_parts)
+    -> std::vector<std::string_view>
+{
+    std::vector<std::string_view> parts;
+    auto const sz = text.size();
+    auto const n = static_cast<std::size_t>(n_parts);
+    parts.reserve(n);
+
+    std::size_t from = 0;
+    for (std::size_t i = 1; i <= n && from < sz; ++i) {
+        std::size_t to = sz;
+        if (i < n) {
+            // If the byte before the target is a delimiter then the target
+            // already starts a record
+            auto target = sz * i / n;
+            if (target <= from) {
+                target = from + 1;
+            }
+            auto const pos = text.find(delim, target - 1);
+            to = pos == std::string_view::npos ? sz : pos + 1;
+        }
+        parts.push_back(text.substr(from, to - from));
+        from = to;
+    }
+
+    return parts;
+}
+
+struct par_text_chunks_fn {
+    template <contiguous_sequence Seq, typename Func, typename Reduce,
+              typename R = std::invoke_result_t<Func&, std::string_view>>
+        requires sized_sequence<Seq> &&
+                 std::same_as<value_t<Seq>, char> &&
+                 std::movable<R> &&
+                 std::invocable<Reduce&, R, R> &&
+                 std::assignable_from<R&, std::invoke_result_t<Reduce&, R, R>>
+    auto operator()(Seq&& seq, char delim, Func func, Reduce reduce,
+                    distance_t n_parts = 0) const
+        -> R
+    {
+        if (n_parts <= 0) {
+            // hardware_concurrency() may return 0 if it can't tell
+            n_parts = static_cast<distance_t>(std::thread::hardware_concurrency());
+            if (n_parts <= 0) {
+                n_parts = 1;
+            }
+        }
+
+        std::string_view const text(flux::data(seq),
+                                    static_cast<std::size_t>(flux::size(seq)));
+        auto const parts = detail::split_at_records(text, delim, n_parts);
+
+        // Make sure we always have a result to return
+        if (parts.size() <= 1) {
+            return std::invoke(func, parts.empty() ? text : parts.front());
+        }
+
+        std::vector<std::optional<R>> results(parts.size());
+        std::vector<std::exception_ptr> errors(parts.size());
+
+        auto run = [&](std::size_t i) {
+            try {
+                results[i].emplace(std::invoke(func, parts[i]));
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        };
+
+        // The calling thread processes the first part itself
+        std::vector<std::thread> workers;
+        workers.reserve(parts.size() - 1);
+        try {
+            for (std::size_t i = 1; i < parts.size(); ++i) {
+                workers.emplace_back(run, i);
+            }
+        } catch (...) {
+            for (auto& w : workers) {
+                w.join();
+            }
+            throw;
+        }
+        run(0);
+        for (auto& w : workers) {
+            w.join();
+        }
+
+        for (auto const& err : errors) {
+            if (err) {
+                std::rethrow_exception(err);
+            }
+        }
+
+        // Results are combined in order, so the reducer need not be commutative
+        R acc = std::move(*results[0]);
+        for (std::size_t i = 1; i < results.size(); ++i) {
+            acc = std::invoke(reduce, std::move(acc), std::move(*results[i]));
+        }
+        return acc;
+    }
+};
+
+} // namespace detail
+
+FLUX_EXPORT inline constexpr auto par_text_chunks = detail::par_text_chunks_fn{};
+
+} // namespace flux
+
+#endif // FLUX_OP_PAR_TEXT_CHUNKS_HPP_INCLUDED
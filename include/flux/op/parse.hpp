@@ -0,0 +1,168 @@
+
+// Copyright (c) 2023 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef FLUX_OP_PARSE_HPP_INCLUDED
+#define FLUX_OP_PARSE_HPP_INCLUDED
+
+#include <flux/core.hpp>
+
+#include <array>
+#include <charconv>
+#include <string_view>
+#include <system_error>
+
+// Some standard libraries (such as libc++ before LLVM 20) only provide
+// std::from_chars for integers, and don't define __cpp_lib_to_chars
+#if defined(__cpp_lib_to_chars) && (__cpp_lib_to_chars >= 201611L)
+#  define FLUX_HAVE_FLOAT_FROM_CHARS 1
+#else
+#  define FLUX_HAVE_FLOAT_FROM_CHARS 0
+#endif
+
+namespace flux {
+
+namespace detail {
+
+template <typename T>
+concept parseable_number =
+#if FLUX_HAVE_FLOAT_FROM_CHARS
+    (std::integral<T> || std::floating_point<T>) &&
+#else
+    std::integral<T> &&
+#endif
+    !std::same_as<std::remove_cv_t<T>, bool> &&
+    std::same_as<std::remove_cv_t<T>, T>;
+
+// A 256-entry lookup table classifying each char as a delimiter or not
+struct delimiter_set {
+    std::array<bool, 256> table_{};
+
+    constexpr explicit delimiter_set(std::string_view delims)
+    {
+        for (char c : delims) {
+            table_[static_cast<unsigned char>(c)] = true;
+        }
+    }
+
+    constexpr auto operator()(char c) const -> bool
+    {
+        return table_[static_cast<unsigned char>(c)];
+    }
+};
+
+inline constexpr std::string_view default_parse_delimiters = " \t\n\v\f\r";
+
+template <parseable_number T, contiguous_sequence Base>
+    requires sized_sequence<Base> && std::same_as<value_t<Base>, char>
+struct parse_adaptor : inline_sequence_base<parse_adaptor<T, Base>> {
+private:
+    FLUX_NO_UNIQUE_ADDRESS Base base_;
+    delimiter_set is_delim_;
+
+public:
+    constexpr parse_adaptor(decays_to<Base> auto&& base, std::string_view delims)
+        : base_(FLUX_FWD(base)),
+          is_delim_(delims)
+    {}
+
+    struct flux_sequence_traits {
+    private:
+        // [from, to) is the current token
+        struct cursor_type {
+            distance_t from = 0;
+            distance_t to = 0;
+
+            friend constexpr auto operator==(cursor_type const& lhs, cursor_type const& rhs)
+                -> bool
+            {
+                return lhs.from == rhs.from;
+            }
+        };
+
+        // Skips any delimiters starting at `pos`, and finds the end of the
+        // token which follows them
+        static constexpr auto make_cursor(auto& self, distance_t pos) -> cursor_type
+        {
+            auto const* data = flux::data(self.base_);
+            auto const sz = flux::size(self.base_);
+
+            while (pos < sz && self.is_delim_(data[pos])) {
+                ++pos;
+            }
+            distance_t end = pos;
+            while (end < sz && !self.is_delim_(data[end])) {
+                ++end;
+            }
+            return cursor_type{.from = pos, .to = end};
+        }
+
+    public:
+        using value_type = flux::optional<T>;
+
+        static constexpr auto first(auto& self) -> cursor_type
+        {
+            return make_cursor(self, 0);
+        }
+
+        static constexpr auto is_last(auto& self, cursor_type const& cur) -> bool
+        {
+            return cur.from >= flux::size(self.base_);
+        }
+
+        static constexpr auto inc(auto& self, cursor_type& cur) -> void
+        {
+            FLUX_DEBUG_ASSERT(!is_last(self, cur));
+            cur = make_cursor(self, cur.to);
+        }
+
+        // Returns nullopt unless the whole token is a valid number
+        static constexpr auto read_at(auto& self, cursor_type const& cur) -> flux::optional<T>
+        {
+            auto const* first = flux::data(self.base_) + cur.from;
+            auto const* last = flux::data(self.base_) + cur.to;
+            // from_chars doesn't accept a leading '+', but we mustn't let
+            // "+-5" through as a negative number
+            if (last - first > 1 && first[0] == '+' && first[1] != '-') {
+                ++first;
+            }
+            T value{};
+            auto [ptr, ec] = std::from_chars(first, last, value);
+            if (ec != std::errc{} || ptr != last) {
+                return flux::nullopt;
+            }
+            return flux::optional<T>(value);
+        }
+
+        static constexpr auto last(auto& self) -> cursor_type
+        {
+            auto const sz = flux::size(self.base_);
+            return cursor_type{.from = sz, .to = sz};
+        }
+    };
+};
+
+template <parseable_number T>
+struct parse_fn {
+    template <adaptable_sequence Seq>
+        requires contiguous_sequence<Seq> && sized_sequence<Seq> &&
+                 std::same_as<value_t<Seq>, char>
+    [[nodiscard]]
+    constexpr auto operator()(Seq&& seq,
+                              std::string_view delims = default_parse_delimiters) const
+    {
+        return parse_adaptor<T, std::decay_t<Seq>>(FLUX_FWD(seq), delims);
+    }
+};
+
+} // namespace detail
+
+FLUX_EXPORT
+template <typename T>
+    requires detail::parseable_number<T>
+inline constexpr auto parse = detail::parse_fn<T>{};
+
+} // namespace flux
+
+#endif // FLUX_OP_PARSE_HPP_INCLUDED
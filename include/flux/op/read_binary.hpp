@@ -0,0 +1,189 @@
+
+// Copyright (c) 2023 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef FLUX_OP_READ_BINARY_HPP_INCLUDED
+#define FLUX_OP_READ_BINARY_HPP_INCLUDED
+
+#include <flux/core.hpp>
+
+#include <array>
+#include <bit>
+#include <cstring>
+
+namespace flux {
+
+namespace detail {
+
+template <typename T>
+concept binary_record = std::is_trivially_copyable_v<T> &&
+                        std::same_as<std::remove_cv_t<T>, T> &&
+                        !std::is_array_v<T>;
+
+// Types whose byte order can be reversed without knowing their layout
+template <typename T>
+concept byte_swappable = binary_record<T> && (std::is_arithmetic_v<T> || std::is_enum_v<T>);
+
+template <byte_swappable T>
+constexpr auto byteswap(T value) -> T
+{
+    auto bytes = std::bit_cast<std::array<unsigned char, sizeof(T)>>(value);
+    for (std::size_t i = 0; i < sizeof(T) / 2; ++i) {
+        auto tmp = bytes[i];
+        bytes[i] = bytes[sizeof(T) - 1 - i];
+        bytes[sizeof(T) - 1 - i] = tmp;
+    }
+    return std::bit_cast<T>(bytes);
+}
+
+template <typename Seq>
+concept byte_buffer = contiguous_sequence<Seq> && sized_sequence<Seq> &&
+                      sizeof(value_t<Seq>) == 1 &&
+                      std::is_trivially_copyable_v<value_t<Seq>>;
+
+/*
+ * A view of a buffer of bytes as an array of T. Elements are read with
+ * memcpy(), so the buffer need not be suitably aligned for T.
+ */
+template <binary_record T, byte_buffer Base>
+struct read_binary_adaptor : inline_sequence_base<read_binary_adaptor<T, Base>> {
+private:
+    FLUX_NO_UNIQUE_ADDRESS Base base_;
+    bool swap_bytes_;
+
+    constexpr auto bytes() const -> unsigned char const*
+    {
+        return reinterpret_cast<unsigned char const*>(flux::data(base_));
+    }
+
+public:
+    constexpr read_binary_adaptor(decays_to<Base> auto&& base, bool swap_bytes)
+        : base_(FLUX_FWD(base)),
+          swap_bytes_(swap_bytes)
+    {
+        if (flux::size(base_) % static_cast<distance_t>(sizeof(T)) != 0) {
+            runtime_error("flux::read_binary(): buffer size is not a multiple of sizeof(T)");
+        }
+    }
+
+    struct flux_sequence_traits {
+    private:
+        static auto read_unchecked(read_binary_adaptor const& self, index_t idx) -> T
+        {
+            std::array<unsigned char, sizeof(T)> buf;
+            std::memcpy(buf.data(),
+                        self.bytes() + idx * static_cast<distance_t>(sizeof(T)),
+                        sizeof(T));
+            auto value = std::bit_cast<T>(buf);
+            if constexpr (byte_swappable<T>) {
+                if (self.swap_bytes_) {
+                    value = detail::byteswap(value);
+                }
+            }
+            return value;
+        }
+
+    public:
+        using value_type = T;
+
+        static constexpr auto first(read_binary_adaptor const&) -> index_t { return 0; }
+
+        static constexpr auto is_last(read_binary_adaptor const& self, index_t idx) -> bool
+        {
+            return idx >= size(self);
+        }
+
+        static constexpr auto inc(read_binary_adaptor const& self, index_t& idx) -> void
+        {
+            FLUX_DEBUG_ASSERT(idx < size(self));
+            idx = num::checked_add(idx, distance_t{1});
+        }
+
+        static auto read_at(read_binary_adaptor const& self, index_t idx) -> T
+        {
+            indexed_bounds_check(idx, size(self));
+            return read_unchecked(self, idx);
+        }
+
+        static auto read_at_unchecked(read_binary_adaptor const& self, index_t idx) -> T
+        {
+            return read_unchecked(self, idx);
+        }
+
+        static constexpr auto dec(read_binary_adaptor const&, index_t& idx) -> void
+        {
+            FLUX_DEBUG_ASSERT(idx > 0);
+            --idx;
+        }
+
+        static constexpr auto last(read_binary_adaptor const& self) -> index_t
+        {
+            return size(self);
+        }
+
+        static constexpr auto inc(read_binary_adaptor const& self, index_t& idx,
+                                  distance_t offset) -> void
+        {
+            index_t nxt = num::checked_add(idx, offset);
+            FLUX_DEBUG_ASSERT(nxt >= 0);
+            FLUX_DEBUG_ASSERT(nxt <= size(self));
+            idx = nxt;
+        }
+
+        static constexpr auto distance(read_binary_adaptor const&, index_t from, index_t to)
+            -> distance_t
+        {
+            return num::checked_sub(to, from);
+        }
+
+        static constexpr auto size(read_binary_adaptor const& self) -> distance_t
+        {
+            return flux::size(self.base_) / static_cast<distance_t>(sizeof(T));
+        }
+
+        static auto for_each_while(read_binary_adaptor const& self, auto&& pred) -> index_t
+        {
+            auto const sz = size(self);
+            index_t idx = 0;
+            for (; idx < sz; idx++) {
+                if (!std::invoke(pred, read_unchecked(self, idx))) {
+                    break;
+                }
+            }
+            return idx;
+        }
+    };
+};
+
+template <binary_record T>
+struct read_binary_fn {
+    template <adaptable_sequence Seq>
+        requires byte_buffer<Seq>
+    [[nodiscard]]
+    constexpr auto operator()(Seq&& seq) const
+    {
+        return read_binary_adaptor<T, std::decay_t<Seq>>(FLUX_FWD(seq), false);
+    }
+
+    // Reads values which were stored with the given byte order
+    template <adaptable_sequence Seq>
+        requires byte_buffer<Seq> && byte_swappable<T>
+    [[nodiscard]]
+    constexpr auto operator()(Seq&& seq, std::endian order) const
+    {
+        return read_binary_adaptor<T, std::decay_t<Seq>>(FLUX_FWD(seq),
+                                                         order != std::endian::native);
+    }
+};
+
+} // namespace detail
+
+FLUX_EXPORT
+template <typename T>
+    requires detail::binary_record<T>
+inline constexpr auto read_binary = detail::read_binary_fn<T>{};
+
+} // namespace flux
+
+#endif // FLUX_OP_READ_BINARY_HPP_INCLUDED
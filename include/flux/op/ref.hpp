@@ -78,6 +78,12 @@ struct passthrough_traits_base {
         return flux::size(self.base());
     }
 
+    template <typename Self>
+    static constexpr auto size_hint(Self& self) -> size_bounds
+    {
+        return flux::size_hint(self.base());
+    }
+
     static constexpr auto last(auto& self) -> decltype(flux::last(self.base()))
     {
         return flux::last(self.base());
@@ -110,6 +116,29 @@ struct passthrough_traits_base {
     {
         return flux::for_each_while(self.base(), FLUX_FWD(pred));
     }
+
+    template <typename Self>
+    static constexpr auto for_each_while_from(Self& self, auto&& from, auto&& pred)
+        -> decltype(detail::for_each_while_from(self.base(), FLUX_FWD(from), FLUX_FWD(pred)))
+    {
+        return detail::for_each_while_from(self.base(), FLUX_FWD(from), FLUX_FWD(pred));
+    }
+};
+
+/*
+ * Strided internal iteration skips over elements of the base, so it can only
+ * be forwarded by adaptors which yield exactly the elements of their base
+ */
+template <typename Base>
+struct same_elements_traits_base : passthrough_traits_base<Base> {
+
+    template <typename Self>
+    static constexpr auto for_each_while_strided(Self& self, auto&& pred,
+                                                 distance_t stride, distance_t& skip)
+        -> decltype(detail::for_each_while_strided(self.base(), FLUX_FWD(pred), stride, skip))
+    {
+        return detail::for_each_while_strided(self.base(), FLUX_FWD(pred), stride, skip);
+    }
 };
 
 template <sequence Base>
@@ -144,8 +173,17 @@ public:
 
     constexpr Base& base() const noexcept { return *base_; }
 
-    struct flux_sequence_traits : passthrough_traits_base<Base> {
+    struct flux_sequence_traits : same_elements_traits_base<Base> {
         using value_type = value_t<Base>;
+
+        // Only forwarded here, since most users of passthrough_traits_base
+        // change which elements they yield
+        template <typename Self>
+        static constexpr auto for_each_segment_while(Self& self, auto&& pred)
+            -> decltype(flux::for_each_segment_while(self.base(), std::ref(pred)))
+        {
+            return flux::for_each_segment_while(self.base(), std::ref(pred));
+        }
     };
 };
 
@@ -171,8 +209,15 @@ public:
     constexpr Base&& base() && noexcept { return std::move(base_); }
     constexpr Base const&& base() const&& noexcept { return std::move(base_); }
 
-    struct flux_sequence_traits : passthrough_traits_base<Base> {
+    struct flux_sequence_traits : same_elements_traits_base<Base> {
         using value_type = value_t<Base>;
+
+        template <typename Self>
+        static constexpr auto for_each_segment_while(Self& self, auto&& pred)
+            -> decltype(flux::for_each_segment_while(self.base(), std::ref(pred)))
+        {
+            return flux::for_each_segment_while(self.base(), std::ref(pred));
+        }
     };
 };
 
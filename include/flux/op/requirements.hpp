@@ -25,6 +25,24 @@ concept foldable_ =
 
 } // namespace detail
 
+FLUX_EXPORT
+template <typename Seq, typename Op, typename Init>
+using sliding_fold_result_t = std::decay_t<std::invoke_result_t<Op&, Init, value_t<Seq> const&>>;
+
+namespace detail {
+
+template <typename Seq, typename Op, typename InvOp, typename Init,
+          typename R = sliding_fold_result_t<Seq, Op, Init>>
+concept sliding_foldable_ =
+    std::invocable<Op&, R, value_t<Seq> const&> &&
+    std::invocable<InvOp&, R, value_t<Seq> const&> &&
+    std::convertible_to<Init, R> &&
+    std::copyable<R> &&
+    std::assignable_from<R&, std::invoke_result_t<Op&, R, value_t<Seq> const&>> &&
+    std::assignable_from<R&, std::invoke_result_t<InvOp&, R, value_t<Seq> const&>>;
+
+} // namespace detail
+
 namespace detail {
 
 template <typename Func, typename E, distance_t N>
@@ -49,6 +67,15 @@ concept foldable =
     std::invocable<Func&, Init, element_t<Seq>> &&
     detail::foldable_<Seq, Func, Init>;
 
+FLUX_EXPORT
+template <typename Seq, typename Op, typename InvOp, typename Init>
+concept sliding_foldable =
+    sequence<Seq> &&
+    std::constructible_from<value_t<Seq>, element_t<Seq>> &&
+    std::movable<value_t<Seq>> &&
+    std::invocable<Op&, Init, value_t<Seq> const&> &&
+    detail::sliding_foldable_<Seq, Op, InvOp, Init>;
+
 FLUX_EXPORT
 template <typename Fn, typename Seq1, typename Seq2 = Seq1>
 concept strict_weak_order_for =
@@ -118,6 +118,11 @@ public:
             return flux::size(self.base_);
         }
 
+        static constexpr auto size_hint(auto& self) -> size_bounds
+        {
+            return flux::size_hint(self.base_);
+        }
+
         static constexpr auto for_each_while(auto& self, auto&& pred) -> cursor_type
             requires bidirectional_sequence<decltype((self.base_))> &&
                      bounded_sequence<decltype((self.base_))>
@@ -138,6 +138,16 @@ public:
             }
         }
 
+        static constexpr auto size_hint(self_t& self) -> size_bounds
+        {
+            if constexpr (Mode == scan_mode::exclusive) {
+                return detail::size_bounds_add(flux::size_hint(self.base_),
+                                               detail::exact_size_bounds(1));
+            } else {
+                return flux::size_hint(self.base_);
+            }
+        }
+
         static constexpr auto for_each_while(self_t& self, auto&& pred) -> cursor_type
             requires (Mode != scan_mode::exclusive)
         {
@@ -95,6 +95,11 @@ public:
             return flux::size(self.base_);
         }
 
+        static constexpr auto size_hint(self_t& self) -> size_bounds
+        {
+            return flux::size_hint(self.base_);
+        }
+
         static constexpr auto for_each_while(self_t& self, auto&& pred) -> cursor_type
         {
             return cursor_type(flux::for_each_while(self.base_, [&](auto&& elem) {
@@ -143,7 +143,17 @@ public:
                 return flux::move_at(self.base2_, cur.base2_cursor);
             }
         }
-        
+
+        template <typename Self>
+            requires maybe_const_iterable<Self>
+        static constexpr auto size_hint(Self& self) -> size_bounds
+        {
+            auto b1 = flux::size_hint(self.base1_);
+            auto b2 = flux::size_hint(self.base2_);
+            auto res = detail::size_bounds_add(b1, b2);
+            res.lower = (cmp::max)(b1.lower, b2.lower);
+            return res;
+        }
     };
 };
 
@@ -247,7 +257,13 @@ public:
         {
             return flux::move_at(self.base1_, cur.base1_cursor);
         }
-        
+
+        template <typename Self>
+            requires maybe_const_iterable<Self>
+        static constexpr auto size_hint(Self& self) -> size_bounds
+        {
+            return detail::size_bounds_at_most(flux::size_hint(self.base1_));
+        }
     };
 };
 
@@ -395,6 +411,15 @@ public:
                 return static_cast<R>(flux::move_at(self.base2_, cur.base2_cursor));
             }
         }
+
+        template <typename Self>
+            requires maybe_const_iterable<Self>
+        static constexpr auto size_hint(Self& self) -> size_bounds
+        {
+            return detail::size_bounds_at_most(
+                detail::size_bounds_add(flux::size_hint(self.base1_),
+                                        flux::size_hint(self.base2_)));
+        }
     };
 };
 
@@ -497,7 +522,15 @@ public:
         {
             return flux::move_at(self.base1_, cur.base1_cursor);
         }
-        
+
+        template <typename Self>
+            requires maybe_const_iterable<Self>
+        static constexpr auto size_hint(Self& self) -> size_bounds
+        {
+            return detail::size_bounds_at_most(
+                detail::size_bounds_min(flux::size_hint(self.base1_),
+                                        flux::size_hint(self.base2_)));
+        }
     };
 };
 
@@ -7,6 +7,7 @@
 #define FLUX_OP_SLICE_HPP_INCLUDED
 
 #include <flux/core.hpp>
+#include <flux/op/for_each_while.hpp>
 #include <flux/op/from.hpp>
 
 namespace flux {
@@ -134,8 +135,46 @@ struct sequence_traits<subsequence<Base, Bounded>>
                flux::distance(*self.base_, flux::first(*self.base_), self.data_.first);
     }
 
+    static constexpr auto for_each_while_from(self_t& self, cursor_t<Base> from, auto&& pred)
+        -> cursor_t<Base>
+        requires (!Bounded || random_access_sequence<Base>)
+    {
+        if constexpr (Bounded) {
+            // Check the count after each element, so the base never reads
+            // the element at last
+            distance_t len = flux::distance(*self.base_, from, self.data_.last);
+            if (len <= 0) {
+                return from;
+            }
+
+            bool count_reached = false;
+            auto cur = detail::for_each_while_from(*self.base_, std::move(from), [&](auto&& elem) {
+                if (!std::invoke(pred, FLUX_FWD(elem))) {
+                    return false;
+                } else if (--len == 0) {
+                    count_reached = true;
+                    return false;
+                }
+                return true;
+            });
+            return count_reached ? self.data_.last : cur;
+        } else {
+            return detail::for_each_while_from(*self.base_, std::move(from), std::ref(pred));
+        }
+    }
+
+    static constexpr auto for_each_while(self_t& self, auto&& pred) -> cursor_t<Base>
+        requires (!Bounded || random_access_sequence<Base>)
+    {
+        return for_each_while_from(self, first(self), pred);
+    }
+
     void size() = delete;
-    void for_each_while() = delete;
+
+    static constexpr auto size_hint(self_t& self) -> size_bounds
+    {
+        return detail::size_bounds_at_most(flux::size_hint(*self.base_));
+    }
 };
 
 FLUX_EXPORT inline constexpr auto slice = detail::slice_fn{};
@@ -108,6 +108,13 @@ public:
             auto s = (flux::size(self.base_) - self.win_sz_) + 1;
             return std::max(s, distance_t{0});
         }
+
+        static constexpr auto size_hint(auto& self) -> size_bounds
+        {
+            auto bounds = flux::size_hint(self.base_);
+            auto windows = [&](distance_t s) { return std::max((s - self.win_sz_) + 1, distance_t{0}); };
+            return {windows(bounds.lower), bounds.upper.map(windows)};
+        }
     };
 };
 
@@ -0,0 +1,333 @@
+
+// Copyright (c) 2023 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef FLUX_OP_SLIDING_FOLD_HPP_INCLUDED
+#define FLUX_OP_SLIDING_FOLD_HPP_INCLUDED
+
+#include <flux/core.hpp>
+#include <flux/op/for_each_while.hpp>
+
+#include <utility> // for std::as_const
+#include <vector>
+
+namespace flux {
+
+namespace detail {
+
+/*
+ * Running fold over the last win_sz elements, for an operation with an
+ * inverse. The elements of the window are kept in a fixed-size ring buffer,
+ * so that the oldest one can be removed from the accumulator when a new one
+ * arrives.
+ */
+template <typename T, typename Op, typename InvOp, typename R>
+struct fold_window {
+    FLUX_NO_UNIQUE_ADDRESS Op op;
+    FLUX_NO_UNIQUE_ADDRESS InvOp inv_op;
+    R init;
+    R accum = init;
+    distance_t win_sz;
+    std::vector<T> elems{};
+    std::size_t oldest = 0;
+
+    constexpr auto reset() -> void
+    {
+        accum = init;
+        elems.clear();
+        oldest = 0;
+    }
+
+    constexpr auto is_full() const -> bool
+    {
+        return elems.size() == static_cast<std::size_t>(win_sz);
+    }
+
+    constexpr auto push(auto&& elem) -> void
+    {
+        if (!is_full()) {
+            elems.emplace_back(FLUX_FWD(elem));
+            accum = std::invoke(op, std::move(accum), std::as_const(elems.back()));
+        } else {
+            accum = std::invoke(inv_op, std::move(accum), std::as_const(elems[oldest]));
+            elems[oldest] = T(FLUX_FWD(elem));
+            accum = std::invoke(op, std::move(accum), std::as_const(elems[oldest]));
+            if (++oldest == elems.size()) {
+                oldest = 0;
+            }
+        }
+    }
+
+    constexpr auto value() const -> R const& { return accum; }
+};
+
+/*
+ * Minimum (according to cmp) of the last win_sz elements. We keep a
+ * double-ended queue of the elements which could still become the minimum
+ * of some window -- that is, those which no later element compares less
+ * than or equal to -- along with their positions. The queue never holds more
+ * than win_sz elements, so it lives in a fixed-size ring buffer. Each element
+ * is pushed and popped at most once, so the amortised cost per step is O(1).
+ */
+template <typename T, typename Cmp>
+struct monotonic_window {
+    FLUX_NO_UNIQUE_ADDRESS Cmp cmp;
+    distance_t win_sz;
+    std::vector<T> elems{};
+    std::vector<distance_t> positions{};
+    std::size_t head = 0;
+    std::size_t count = 0;
+    distance_t next_pos = 0;
+
+    // The buffers keep their size, so that the slots can be reused
+    constexpr auto reset() -> void
+    {
+        head = 0;
+        count = 0;
+        next_pos = 0;
+    }
+
+    constexpr auto slot(std::size_t i) const -> std::size_t
+    {
+        return (head + i) % static_cast<std::size_t>(win_sz);
+    }
+
+    constexpr auto is_full() const -> bool { return next_pos >= win_sz; }
+
+    constexpr auto push(auto&& elem) -> void
+    {
+        T val(FLUX_FWD(elem));
+
+        // Drop the front element if it's about to leave the window...
+        if (count > 0 && positions[head] <= next_pos - win_sz) {
+            head = slot(1);
+            --count;
+        }
+
+        // ...and any elements at the back which can no longer be the minimum
+        while (count > 0 && !std::invoke(cmp, elems[slot(count - 1)], val)) {
+            --count;
+        }
+
+        // Slots are first used in order, so we only need to grow the buffers
+        // until every slot has been used once
+        auto const back = slot(count);
+        if (back == elems.size()) {
+            elems.push_back(std::move(val));
+            positions.push_back(next_pos);
+        } else {
+            elems[back] = std::move(val);
+            positions[back] = next_pos;
+        }
+        ++count;
+        ++next_pos;
+    }
+
+    constexpr auto value() const -> T const& { return elems[head]; }
+};
+
+template <typename Cmp>
+struct reversed_cmp {
+    FLUX_NO_UNIQUE_ADDRESS Cmp cmp;
+
+    constexpr auto operator()(auto&& lhs, auto&& rhs) -> bool
+    {
+        return std::invoke(cmp, FLUX_FWD(rhs), FLUX_FWD(lhs));
+    }
+};
+
+// Number of complete windows in a sequence of n elements
+constexpr auto sliding_window_count(distance_t n, distance_t win_sz) -> distance_t
+{
+    return n < win_sz ? 0 : n - win_sz + 1;
+}
+
+template <typename Base, typename Window>
+struct sliding_adaptor : inline_sequence_base<sliding_adaptor<Base, Window>> {
+private:
+    FLUX_NO_UNIQUE_ADDRESS Base base_;
+    Window window_;
+
+public:
+    constexpr sliding_adaptor(decays_to<Base> auto&& base, Window&& window)
+        : base_(FLUX_FWD(base)),
+          window_(std::move(window))
+    {}
+
+    sliding_adaptor(sliding_adaptor&&) = default;
+    sliding_adaptor& operator=(sliding_adaptor&&) = default;
+
+    struct flux_sequence_traits {
+    private:
+        struct cursor_type {
+            cursor_type(cursor_type&&) = default;
+            cursor_type& operator=(cursor_type&&) = default;
+
+        private:
+            friend struct flux_sequence_traits;
+
+            constexpr explicit cursor_type(cursor_t<Base>&& base_cur)
+                : base_cur(std::move(base_cur))
+            {}
+
+            cursor_t<Base> base_cur;
+        };
+
+        using self_t = sliding_adaptor;
+
+    public:
+        static inline constexpr bool is_infinite = infinite_sequence<Base>;
+
+        // Fills the first window, leaving the cursor at its last element
+        static constexpr auto first(self_t& self) -> cursor_type
+        {
+            self.window_.reset();
+            auto cur = flux::first(self.base_);
+            while (!flux::is_last(self.base_, cur)) {
+                self.window_.push(flux::read_at(self.base_, cur));
+                if (self.window_.is_full()) {
+                    break;
+                }
+                flux::inc(self.base_, cur);
+            }
+            return cursor_type(std::move(cur));
+        }
+
+        static constexpr auto is_last(self_t& self, cursor_type const& cur) -> bool
+        {
+            return flux::is_last(self.base_, cur.base_cur);
+        }
+
+        static constexpr auto inc(self_t& self, cursor_type& cur) -> void
+        {
+            flux::inc(self.base_, cur.base_cur);
+            if (!flux::is_last(self.base_, cur.base_cur)) {
+                self.window_.push(flux::read_at(self.base_, cur.base_cur));
+            }
+        }
+
+        static constexpr auto read_at(self_t& self, cursor_type const&) -> decltype(auto)
+        {
+            return std::as_const(self.window_).value();
+        }
+
+        static constexpr auto last(self_t& self) -> cursor_type
+            requires bounded_sequence<Base>
+        {
+            return cursor_type(flux::last(self.base_));
+        }
+
+        static constexpr auto size(self_t& self) -> distance_t
+            requires sized_sequence<Base>
+        {
+            return sliding_window_count(flux::size(self.base_), self.window_.win_sz);
+        }
+
+        static constexpr auto size_hint(self_t& self) -> size_bounds
+        {
+            auto const bounds = flux::size_hint(self.base_);
+            return {sliding_window_count(bounds.lower, self.window_.win_sz),
+                    bounds.upper.map([&self](distance_t n) {
+                        return sliding_window_count(n, self.window_.win_sz);
+                    })};
+        }
+
+        static constexpr auto for_each_while(self_t& self, auto&& pred) -> cursor_type
+        {
+            self.window_.reset();
+            return cursor_type(flux::for_each_while(self.base_, [&](auto&& elem) {
+                self.window_.push(FLUX_FWD(elem));
+                return !self.window_.is_full() ||
+                       std::invoke(pred, std::as_const(self.window_).value());
+            }));
+        }
+    };
+};
+
+struct sliding_fold_fn {
+    template <adaptable_sequence Seq, typename Op, typename InvOp,
+              std::movable Init = value_t<Seq>,
+              typename R = sliding_fold_result_t<Seq, Op, Init>>
+        requires sliding_foldable<Seq, Op, InvOp, Init>
+    [[nodiscard]]
+    constexpr auto operator()(Seq&& seq, std::integral auto win_sz, Op op, InvOp inv_op,
+                              Init init = Init{}) const
+        -> sequence auto
+    {
+        FLUX_ASSERT(win_sz > 0);
+        using window_t = fold_window<value_t<Seq>, Op, InvOp, R>;
+        return sliding_adaptor<std::decay_t<Seq>, window_t>(
+            FLUX_FWD(seq),
+            window_t{.op = std::move(op),
+                     .inv_op = std::move(inv_op),
+                     .init = R(std::move(init)),
+                     .win_sz = checked_cast<distance_t>(win_sz)});
+    }
+};
+
+struct sliding_min_fn {
+    template <adaptable_sequence Seq, typename Cmp = std::ranges::less>
+        requires strict_weak_order_for<Cmp, Seq> &&
+                 std::constructible_from<value_t<Seq>, element_t<Seq>> &&
+                 std::movable<value_t<Seq>>
+    [[nodiscard]]
+    constexpr auto operator()(Seq&& seq, std::integral auto win_sz, Cmp cmp = Cmp{}) const
+        -> sequence auto
+    {
+        FLUX_ASSERT(win_sz > 0);
+        using window_t = monotonic_window<value_t<Seq>, Cmp>;
+        return sliding_adaptor<std::decay_t<Seq>, window_t>(
+            FLUX_FWD(seq),
+            window_t{.cmp = std::move(cmp), .win_sz = checked_cast<distance_t>(win_sz)});
+    }
+};
+
+struct sliding_max_fn {
+    template <adaptable_sequence Seq, typename Cmp = std::ranges::less>
+        requires strict_weak_order_for<Cmp, Seq> &&
+                 std::constructible_from<value_t<Seq>, element_t<Seq>> &&
+                 std::movable<value_t<Seq>>
+    [[nodiscard]]
+    constexpr auto operator()(Seq&& seq, std::integral auto win_sz, Cmp cmp = Cmp{}) const
+        -> sequence auto
+    {
+        return sliding_min_fn{}(FLUX_FWD(seq), win_sz, reversed_cmp<Cmp>{std::move(cmp)});
+    }
+};
+
+} // namespace detail
+
+FLUX_EXPORT inline constexpr auto sliding_fold = detail::sliding_fold_fn{};
+FLUX_EXPORT inline constexpr auto sliding_min = detail::sliding_min_fn{};
+FLUX_EXPORT inline constexpr auto sliding_max = detail::sliding_max_fn{};
+
+template <typename Derived>
+template <typename D, typename Op, typename InvOp, typename Init>
+    requires sliding_foldable<Derived, Op, InvOp, Init>
+constexpr auto inline_sequence_base<Derived>::sliding_fold(std::integral auto win_sz,
+                                                           Op op, InvOp inv_op, Init init) &&
+{
+    return flux::sliding_fold(std::move(derived()), win_sz, std::move(op),
+                              std::move(inv_op), std::move(init));
+}
+
+template <typename Derived>
+template <typename Cmp>
+    requires strict_weak_order_for<Cmp, Derived>
+constexpr auto inline_sequence_base<Derived>::sliding_max(std::integral auto win_sz, Cmp cmp) &&
+{
+    return flux::sliding_max(std::move(derived()), win_sz, std::move(cmp));
+}
+
+template <typename Derived>
+template <typename Cmp>
+    requires strict_weak_order_for<Cmp, Derived>
+constexpr auto inline_sequence_base<Derived>::sliding_min(std::integral auto win_sz, Cmp cmp) &&
+{
+    return flux::sliding_min(std::move(derived()), win_sz, std::move(cmp));
+}
+
+} // namespace flux
+
+#endif // FLUX_OP_SLIDING_FOLD_HPP_INCLUDED
@@ -6,19 +6,84 @@
 #include <flux/op/detail/pdqsort.hpp>
 #include <flux/op/unchecked.hpp>
 
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
 namespace flux {
 
 namespace detail {
 
+// Moves the elements of a segmented sequence back from a buffer, one segment
+// at a time, when going out of scope. The buffer may hold fewer elements
+// than the sequence, if moving them out was interrupted by an exception.
+template <typename Seq>
+struct segment_restorer {
+    Seq& seq;
+    std::vector<value_t<Seq>>& buf;
+
+    constexpr ~segment_restorer()
+    {
+        auto iter = buf.begin();
+        flux::for_each_segment_while(seq, [this, &iter](auto& segment) {
+            auto const n = (std::min)(flux::size(segment),
+                                      static_cast<distance_t>(buf.end() - iter));
+            std::move(iter, iter + n, flux::data(segment));
+            iter += n;
+            return n;
+        });
+    }
+};
+
 struct sort_fn {
+private:
+    // Rather than sorting a segmented sequence such as a std::deque in place,
+    // it's faster to move its elements into a contiguous buffer, sort that,
+    // and then move them back
+    template <typename Seq>
+    static constexpr bool sort_via_buffer =
+        segmented_sequence<Seq> &&
+        !contiguous_sequence<Seq> &&
+        std::same_as<element_t<Seq>, value_t<Seq>&> &&
+        std::movable<value_t<Seq>>;
+
+    template <typename Seq, typename Cmp>
+    static constexpr auto buffered_sort(Seq& seq, Cmp& cmp) -> void
+    {
+        std::vector<value_t<Seq>> buf;
+        buf.reserve(flux::usize(seq));
+
+        // Puts the elements back even if a move or a comparison throws. We
+        // move elements out one at a time, so that the buffer always holds
+        // exactly those which have been moved.
+        segment_restorer<Seq> restorer{seq, buf};
+
+        flux::for_each_segment_while(seq, [&buf](auto& segment) {
+            auto* const ptr = flux::data(segment);
+            auto const n = flux::size(segment);
+            for (distance_t i = 0; i < n; i++) {
+                buf.push_back(std::move(ptr[i]));
+            }
+            return n;
+        });
+
+        auto wrapper = flux::unchecked(flux::mut_ref(buf));
+        detail::pdqsort(wrapper, cmp);
+    }
+
+public:
     template <random_access_sequence Seq, typename Cmp = std::ranges::less>
         requires bounded_sequence<Seq> &&
                  element_swappable_with<Seq, Seq> &&
                  strict_weak_order_for<Cmp, Seq>
     constexpr auto operator()(Seq&& seq, Cmp cmp = {}) const
     {
-        auto wrapper = flux::unchecked(flux::from_fwd_ref(FLUX_FWD(seq)));
-        detail::pdqsort(wrapper, cmp);
+        if constexpr (sort_via_buffer<Seq>) {
+            buffered_sort(seq, cmp);
+        } else {
+            auto wrapper = flux::unchecked(flux::from_fwd_ref(FLUX_FWD(seq)));
+            detail::pdqsort(wrapper, cmp);
+        }
     }
 };
 
@@ -11,8 +11,12 @@
 #include <flux/op/from.hpp>
 #include <flux/op/search.hpp>
 #include <flux/op/slice.hpp>
+#include <flux/source/array_ptr.hpp>
 #include <flux/source/single.hpp>
 
+#include <utility>
+#include <vector>
+
 namespace flux {
 
 namespace detail {
@@ -22,6 +26,12 @@ concept splitter_for = requires(Splitter& splitter, Seq& seq, cursor_t<Seq> cons
     { splitter(flux::slice(seq, cur, flux::last)) } -> std::same_as<bounds_t<Seq>>;
 };
 
+constexpr auto split_size_hint(size_bounds const& base) -> size_bounds
+{
+    return {(cmp::min)(base.lower, distance_t{1}),
+            size_bounds_add(base, exact_size_bounds(1)).upper};
+}
+
 template <multipass_sequence Base, splitter_for<Base> Splitter>
 struct split_adaptor : inline_sequence_base<split_adaptor<Base, Splitter>> {
 private:
@@ -92,6 +102,112 @@ public:
         {
             return cursor_type{.cur = flux::last(self.base_)};
         }
+
+        // A non-empty base splits into at least one and at most n+1 pieces
+        static constexpr auto size_hint(auto& self) -> size_bounds
+        {
+            return split_size_hint(flux::size_hint(self.base_));
+        }
+    };
+};
+
+/*
+ * Splitting single-pass sequences
+ *
+ * We can't hand out slices of a single-pass base, so instead each field is
+ * copied into an internal buffer, which is reused for the next field. The
+ * elements are views of the buffer which remain valid until the next call
+ * to inc(). The buffer only ever grows to the size of the longest field.
+ */
+template <sequence Base, typename Pred>
+struct split_single_pass_adaptor
+    : inline_sequence_base<split_single_pass_adaptor<Base, Pred>> {
+private:
+    FLUX_NO_UNIQUE_ADDRESS Base base_;
+    FLUX_NO_UNIQUE_ADDRESS Pred pred_;
+    std::vector<value_t<Base>> buffer_;
+    bool has_more_ = true;
+    bool done_ = false;
+
+public:
+    constexpr split_single_pass_adaptor(decays_to<Base> auto&& base, decays_to<Pred> auto&& pred)
+        : base_(FLUX_FWD(base)),
+          pred_(FLUX_FWD(pred))
+    {}
+
+    split_single_pass_adaptor(split_single_pass_adaptor&&) = default;
+    split_single_pass_adaptor& operator=(split_single_pass_adaptor&&) = default;
+
+    struct flux_sequence_traits {
+    private:
+        using self_t = split_single_pass_adaptor;
+
+        struct cursor_type {
+            cursor_t<Base> cur;
+
+            constexpr explicit cursor_type(cursor_t<Base>&& c) : cur(std::move(c)) {}
+            cursor_type(cursor_type&&) = default;
+            cursor_type& operator=(cursor_type&&) = default;
+        };
+
+        static constexpr auto read_field(self_t& self, cursor_type& cur) -> void
+        {
+            if (!self.has_more_) {
+                self.done_ = true;
+                return;
+            }
+
+            self.buffer_.clear();
+            cur.cur = detail::for_each_while_from(self.base_, std::move(cur.cur),
+                [&self](auto&& elem) {
+                    if (std::invoke(self.pred_, std::as_const(elem))) {
+                        return false;
+                    }
+                    self.buffer_.push_back(FLUX_FWD(elem));
+                    return true;
+                });
+
+            // If we stopped at a delimiter then there is at least one more
+            // (possibly empty) field after it
+            if (flux::is_last(self.base_, cur.cur)) {
+                self.has_more_ = false;
+            } else {
+                flux::inc(self.base_, cur.cur);
+            }
+        }
+
+    public:
+        static constexpr auto first(self_t& self) -> cursor_type
+        {
+            cursor_type cur{flux::first(self.base_)};
+            self.has_more_ = !flux::is_last(self.base_, cur.cur);
+            self.done_ = false;
+            read_field(self, cur);
+            return cur;
+        }
+
+        static constexpr auto is_last(self_t& self, cursor_type const&) -> bool
+        {
+            return self.done_;
+        }
+
+        static constexpr auto inc(self_t& self, cursor_type& cur) -> void
+        {
+            FLUX_DEBUG_ASSERT(!self.done_);
+            read_field(self, cur);
+        }
+
+        static constexpr auto read_at(self_t& self, cursor_type const&)
+            -> array_ptr<value_t<Base> const>
+        {
+            return make_array_ptr_unchecked(std::as_const(self.buffer_).data(),
+                                            self.buffer_.size());
+        }
+
+        static constexpr auto size_hint(self_t& self) -> size_bounds
+        {
+            return split_size_hint(flux::size_hint(self.base_));
+        }
     };
 };
 
@@ -201,6 +317,29 @@ struct split_fn {
         return split_adaptor<std::decay_t<Seq>, splitter_t>(
             FLUX_FWD(seq), splitter_t(std::move(pred)));
     }
+
+    template <adaptable_sequence Seq, typename Delim>
+        requires (!multipass_sequence<Seq>) &&
+                 std::copy_constructible<value_t<Seq>> &&
+                 std::equality_comparable_with<element_t<Seq>, Delim const&>
+    [[nodiscard]]
+    constexpr auto operator()(Seq&& seq, Delim&& delim) const
+    {
+        auto pred = flux::pred::eq(FLUX_FWD(delim));
+        return split_single_pass_adaptor<std::decay_t<Seq>, decltype(pred)>(
+            FLUX_FWD(seq), std::move(pred));
+    }
+
+    template <adaptable_sequence Seq, typename Pred>
+        requires (!multipass_sequence<Seq>) &&
+                 std::copy_constructible<value_t<Seq>> &&
+                 std::predicate<Pred const&, element_t<Seq>>
+    [[nodiscard]]
+    constexpr auto operator()(Seq&& seq, Pred pred) const
+    {
+        return split_single_pass_adaptor<std::decay_t<Seq>, Pred>(
+            FLUX_FWD(seq), std::move(pred));
+    }
 };
 
 } // namespace detail
@@ -219,8 +358,7 @@ constexpr auto inline_sequence_base<Derived>::split(Pattern&& pattern) &&
 
 template <typename Derived>
 template <typename Delim>
-    requires multipass_sequence<Derived> &&
-             std::equality_comparable_with<element_t<Derived>, Delim const&>
+    requires std::equality_comparable_with<element_t<Derived>, Delim const&>
 constexpr auto inline_sequence_base<Derived>::split(Delim&& delim) &&
 {
     return flux::split(std::move(derived()), FLUX_FWD(delim));
@@ -228,8 +366,7 @@ constexpr auto inline_sequence_base<Derived>::split(Delim&& delim) &&
 
 template <typename Derived>
 template <typename Pred>
-    requires multipass_sequence<Derived> &&
-             std::predicate<Pred const&, element_t<Derived>>
+    requires std::predicate<Pred const&, element_t<Derived>>
 constexpr auto inline_sequence_base<Derived>::split(Pred pred) &&
 {
     return flux::split(std::move(derived()), std::move(pred));
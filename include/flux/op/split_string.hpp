@@ -15,9 +15,6 @@ namespace flux {
 
 namespace detail {
 
-template <typename C>
-concept character = any_of<C, char, wchar_t, char8_t, char16_t, char32_t>;
-
 struct to_string_view_fn {
     template <contiguous_sequence Seq>
         requires sized_sequence<Seq> && character<value_t<Seq>>
@@ -54,6 +51,15 @@ struct split_string_fn {
     {
         return flux::split(FLUX_FWD(seq), delim).map(to_string_view);
     }
+
+    // For single-pass sequences the string_views refer to an internal buffer,
+    // and are invalidated when the sequence is incremented
+    template <sequence Seq>
+        requires (!multipass_sequence<Seq>) && character<value_t<Seq>>
+    constexpr auto operator()(Seq&& seq, value_t<Seq> delim) const
+    {
+        return flux::split(FLUX_FWD(seq), delim).map(to_string_view);
+    }
 };
 
 } // namespace detail
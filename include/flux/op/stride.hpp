@@ -7,6 +7,7 @@
 #define FLUX_OP_STRIDE_HPP_INCLUDED
 
 #include <flux/core.hpp>
+#include <flux/op/for_each_while.hpp>
 
 namespace flux {
 
@@ -95,20 +96,21 @@ public:
             return s/self.stride_ + (s % self.stride_ == 0 ? 0 : 1);
         }
 
+        static constexpr auto size_hint(auto& self) -> size_bounds
+        {
+            auto bounds = flux::size_hint(self.base_);
+            auto div = [&](distance_t s) { return s/self.stride_ + (s % self.stride_ == 0 ? 0 : 1); };
+            return {div(bounds.lower), bounds.upper.map(div)};
+        }
+
         static constexpr auto for_each_while(auto& self, auto&& pred) -> cursor_t<Base>
             requires sequence<decltype((self.base_))>
         {
-            distance_t n = self.stride_;
-            return flux::for_each_while(self.base_, [&n, &pred, s = self.stride_](auto&& elem) {
-                if (++n < s) {
-                    return true;
-                } else {
-                    n = 0;
-                    return std::invoke(pred, FLUX_FWD(elem));
-                }
-            });
+            distance_t skip = 0;
+            return detail::for_each_while_strided(self.base_, std::ref(pred), self.stride_, skip);
         }
 
+        void for_each_while_from(...) = delete;
     };
 };
 
@@ -214,6 +216,13 @@ public:
             return s/self.stride_ + (s % self.stride_ == 0 ? 0 : 1);
         }
 
+        static constexpr auto size_hint(auto& self) -> size_bounds
+        {
+            auto bounds = flux::size_hint(self.base_);
+            auto div = [&](distance_t s) { return s/self.stride_ + (s % self.stride_ == 0 ? 0 : 1); };
+            return {div(bounds.lower), bounds.upper.map(div)};
+        }
+
         static constexpr auto distance(auto& self, cursor_type const& from,
                                        cursor_type const& to) -> distance_t
             requires random_access_sequence<Base>
@@ -235,16 +244,9 @@ public:
         static constexpr auto for_each_while(auto& self, auto&& pred) -> cursor_type
             requires sequence<decltype((self.base_))>
         {
-            distance_t n = self.stride_;
-            auto c = flux::for_each_while(self.base_, [&n, &pred, s = self.stride_](auto&& elem) {
-                if (++n < s) {
-                    return true;
-                } else {
-                    n = 0;
-                    return std::invoke(pred, FLUX_FWD(elem));
-                }
-            });
-            return cursor_type{std::move(c), (n + 1) % self.stride_};
+            distance_t skip = 0;
+            auto c = detail::for_each_while_strided(self.base_, std::ref(pred), self.stride_, skip);
+            return cursor_type{std::move(c), skip};
         }
     };
 };
@@ -9,6 +9,7 @@
 #include <flux/core.hpp>
 #include <flux/op/for_each_while.hpp>
 #include <flux/op/slice.hpp>
+#include <flux/op/stride.hpp>
 
 namespace flux {
 
@@ -40,6 +41,30 @@ public:
             friend auto operator<=>(cursor_type const& lhs, cursor_type const& rhs) = default;
         };
 
+        // We count down the remaining length after each element, rather than
+        // before, so that the base never reads the element after our end.
+        // `iterate` runs the base's internal iteration with the predicate it
+        // is given.
+        static constexpr auto counted_while(auto& self, distance_t len, auto& pred,
+                                            auto iterate) -> cursor_type
+        {
+            bool count_reached = false;
+            auto cur = iterate([&](auto&& elem) {
+                if (!std::invoke(pred, FLUX_FWD(elem))) {
+                    return false;
+                } else if (--len == 0) {
+                    count_reached = true;
+                    return false;
+                }
+                return true;
+            });
+
+            if (count_reached) {
+                flux::inc(self.base_, cur);
+            }
+            return cursor_type{.base_cur = std::move(cur), .length = len};
+        }
+
     public:
         using value_type = value_t<Base>;
 
@@ -123,6 +148,12 @@ public:
             }
         }
 
+        static constexpr auto size_hint(auto& self) -> size_bounds
+        {
+            return detail::size_bounds_min(flux::size_hint(self.base_),
+                                           detail::exact_size_bounds(self.count_));
+        }
+
         static constexpr auto last(auto& self) -> cursor_type
             requires (random_access_sequence<Base> && sized_sequence<Base>) ||
                       infinite_sequence<Base>
@@ -135,12 +166,73 @@ public:
 
         static constexpr auto for_each_while(auto& self, auto&& pred) -> cursor_type
         {
-            distance_t len = self.count_;
-            auto cur = flux::for_each_while(self.base_, [&](auto&& elem) {
-                return (len-- > 0) && std::invoke(pred, FLUX_FWD(elem));
+            if (self.count_ <= 0) {
+                return first(self);
+            }
+            return counted_while(self, self.count_, pred, [&self](auto&& base_pred) {
+                return flux::for_each_while(self.base_, FLUX_FWD(base_pred));
             });
+        }
 
-            return cursor_type{.base_cur = std::move(cur), .length = ++len};
+        static constexpr auto for_each_while_from(auto& self, cursor_type from, auto&& pred)
+            -> cursor_type
+        {
+            if (from.length <= 0) {
+                return from;
+            }
+            return counted_while(self, from.length, pred, [&self, &from](auto&& base_pred) {
+                return detail::for_each_while_from(self.base_, std::move(from).base_cur,
+                                                   FLUX_FWD(base_pred));
+            });
+        }
+
+        // Visits the elements at positions skip, skip + stride, ... which are
+        // less than count_, stopping the base before it reads any element
+        // beyond the end of the take. Not needed when we are random-access
+        // and bounded, as the default implementation can jump instead.
+        static constexpr auto for_each_while_strided(auto& self, auto&& pred,
+                                                     distance_t stride, distance_t& skip)
+            -> cursor_type
+            requires (!random_access_sequence<Base> ||
+                      !(sized_sequence<Base> || infinite_sequence<Base>))
+        {
+            if (skip >= self.count_) {
+                auto cur = flux::first(self.base_);
+                distance_t n = detail::advance(self.base_, cur, self.count_);
+                skip -= n;
+                return cursor_type{.base_cur = std::move(cur), .length = self.count_ - n};
+            }
+
+            distance_t pos = skip;
+            bool pred_stopped = false;
+            bool count_reached = false;
+
+            auto cur = detail::for_each_while_strided(self.base_, [&](auto&& elem) {
+                if (!std::invoke(pred, FLUX_FWD(elem))) {
+                    pred_stopped = true;
+                    return false;
+                } else if (self.count_ - pos <= stride) {
+                    count_reached = true;
+                    return false;
+                }
+                pos += stride;
+                return true;
+            }, stride, skip);
+
+            if (pred_stopped) {
+                return cursor_type{.base_cur = std::move(cur), .length = self.count_ - pos};
+            } else if (count_reached) {
+                // cur is the last element we visited: step over the rest
+                // of the take without reading them
+                distance_t n = detail::advance(self.base_, cur, self.count_ - pos);
+                skip = stride - n;
+                return cursor_type{.base_cur = std::move(cur),
+                                   .length = self.count_ - pos - n};
+            } else {
+                // The base ran out first, having stepped over pos - skip elements
+                return cursor_type{.base_cur = std::move(cur),
+                                   .length = self.count_ - (pos - skip)};
+            }
         }
     };
 };
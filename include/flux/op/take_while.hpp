@@ -72,6 +72,12 @@ struct sequence_traits<detail::take_while_adaptor<Base, Pred>>
     void last() = delete;
     void size() = delete;
 
+    static constexpr auto size_hint(auto& self) -> size_bounds
+    {
+        return detail::size_bounds_at_most(flux::size_hint(self.base_));
+    }
+    void for_each_while_from(...) = delete;
+
     static constexpr auto for_each_while(auto& self, auto&& func)
     {
         return flux::for_each_while(self.base_, [&](auto&& elem) {
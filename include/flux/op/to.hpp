@@ -9,6 +9,9 @@
 #include <flux/core.hpp>
 #include <flux/op/map.hpp>
 #include <flux/op/output_to.hpp>
+#include <flux/op/transform_inplace.hpp>
+
+#include <memory_resource>
 
 namespace flux {
 
@@ -19,6 +22,37 @@ struct from_sequence_t {
 
 FLUX_EXPORT inline constexpr auto from_sequence = from_sequence_t{};
 
+/*
+ * A monotonic ("bump") memory resource. Allocations are carved out of large
+ * blocks obtained from the upstream resource, deallocation does nothing, and
+ * all memory is returned at once when the arena is destroyed. Passing
+ * `&arena` to flux::to() lets a container and all its nested containers be
+ * built with a handful of upstream allocations.
+ */
+FLUX_EXPORT
+class arena : public std::pmr::monotonic_buffer_resource {
+public:
+    explicit arena(std::size_t initial_size = 64 * 1024,
+                   std::pmr::memory_resource* upstream = std::pmr::get_default_resource())
+        : std::pmr::monotonic_buffer_resource(initial_size, upstream)
+    {}
+
+    arena(void* buffer, std::size_t buffer_size,
+          std::pmr::memory_resource* upstream = std::pmr::get_default_resource())
+        : std::pmr::monotonic_buffer_resource(buffer, buffer_size, upstream)
+    {}
+
+    arena(arena&&) = delete;
+
+    ~arena() override = default;
+
+    template <typename T = std::byte>
+    [[nodiscard]] auto allocator() -> std::pmr::polymorphic_allocator<T>
+    {
+        return std::pmr::polymorphic_allocator<T>(this);
+    }
+};
+
 namespace detail {
 
 template <typename C, typename Seq, typename... Args>
@@ -41,6 +75,58 @@ template <typename C, typename Seq, typename... Args>
 concept cpp17_range_constructible =
     std::constructible_from<C, common_iterator_t<Seq>, common_iterator_t<Seq>, Args...>;
 
+/*
+ * When converting nested sequences, an allocator or memory_resource* passed
+ * as the sole extra argument is also used for the inner containers, provided
+ * their allocator type can be constructed from it.
+ */
+template <typename Inner, typename... Args>
+concept has_inner_allocator =
+    sizeof...(Args) == 1 &&
+    requires { typename Inner::allocator_type; } &&
+    (std::constructible_from<typename Inner::allocator_type,
+                             std::remove_cvref_t<Args> const&> && ...);
+
+template <typename Base>
+struct owned_container {
+    using type = Base;
+};
+
+template <typename Base>
+struct owned_container<owning_adaptor<Base>> {
+    using type = Base;
+};
+
+template <typename Seq>
+using map_owned_container_t =
+    typename owned_container<std::remove_cvref_t<decltype(FLUX_DECLVAL(Seq&).base())>>::type;
+
+/*
+ * Converting an rvalue map over an owned contiguous container, to the same
+ * container type, with a function which doesn't change the element type,
+ * can reuse the existing buffer rather than allocating a new one
+ */
+template <typename C, typename Seq, typename... Args>
+concept map_reusable_container =
+    sizeof...(Args) == 0 &&
+    !std::is_reference_v<Seq> &&
+    !std::is_const_v<Seq> &&
+    is_map_adaptor<Seq> &&
+    std::same_as<map_owned_container_t<Seq>, C> &&
+    contiguous_sequence<C> &&
+    std::same_as<value_t<Seq>, container_value_t<C>> &&
+    writable_sequence_of<C, element_t<Seq>>;
+
+template <typename Seq>
+constexpr auto take_owned_container(Seq&& seq) -> map_owned_container_t<Seq>
+{
+    if constexpr (std::same_as<decltype(std::move(seq).base()), map_owned_container_t<Seq>&&>) {
+        return std::move(seq).base();
+    } else {
+        return std::move(seq).base().base();
+    }
+}
+
 template <typename C, typename Elem>
 concept container_insertable =
     requires (C& c, Elem&& elem) {
@@ -56,14 +142,19 @@ concept container_convertible =
     (  std::constructible_from<C, Args...> &&
         container_insertable<C, element_t<Seq>>);
 
-template <typename C>
-concept reservable_container =
-    std::ranges::sized_range<C> &&
-    requires (C& c, std::ranges::range_size_t<C> sz) {
-        c.reserve(sz);
-        { c.max_size() } -> std::same_as<std::ranges::range_size_t<C>>;
-        { c.capacity() } -> std::same_as<std::ranges::range_size_t<C>>;
-    };
+/*
+ * A sequence which doesn't know its size but can bound it is better off
+ * being inserted into a container reserved from its size hint than handed
+ * over as an iterator pair, which either walks the sequence twice or makes
+ * the container grow geometrically
+ */
+template <typename C, typename Seq, typename... Args>
+concept hint_insertable =
+    !sized_sequence<Seq> &&
+    has_custom_size_hint<std::remove_reference_t<Seq>> &&
+    hint_reservable_container<C> &&
+    std::constructible_from<C, Args...> &&
+    container_insertable<C, element_t<Seq>>;
 
 template <typename Elem, typename C>
 constexpr auto make_inserter(C& c)
@@ -75,6 +166,28 @@ constexpr auto make_inserter(C& c)
     }
 }
 
+// Containers of the right type can be filled from a bulk simple sequence a
+// block at a time, using range insertion
+template <typename C, typename Seq>
+concept bulk_fillable_container =
+    bulk_simple_sequence<std::remove_reference_t<Seq>> &&
+    std::same_as<container_value_t<C>, simple_value_t<std::remove_reference_t<Seq>>> &&
+    requires (C& c, container_value_t<C>* ptr) {
+        c.insert(c.end(), std::make_move_iterator(ptr), std::make_move_iterator(ptr));
+    };
+
+template <typename C>
+constexpr void bulk_fill(auto& seq, C& c)
+{
+    using value_type = container_value_t<C>;
+    std::array<value_type, bulk_block_size<value_type>> buf;
+
+    while (std::size_t n = bulk_next_n(seq, std::span<value_type>(buf))) {
+        c.insert(c.end(), std::make_move_iterator(buf.data()),
+                 std::make_move_iterator(buf.data() + n));
+    }
+}
+
 template <template <typename...> typename C, typename Seq, typename... Args>
 using ctad_direct_seq = decltype(C(FLUX_DECLVAL(Seq), FLUX_DECLVAL(Args)...));
 
@@ -126,26 +239,50 @@ template <typename Container, sequence Seq, typename... Args>
 constexpr auto to(Seq&& seq, Args&&... args) -> Container
 {
     if constexpr (std::convertible_to<element_t<Seq>, detail::container_value_t<Container>>) {
-        if constexpr (detail::direct_sequence_constructible<Container, Seq, Args...>) {
+        if constexpr (detail::map_reusable_container<Container, Seq, Args...>) {
+            auto c = detail::take_owned_container(std::move(seq));
+            flux::transform_inplace(c, seq.func());
+            return c;
+        } else if constexpr (detail::bulk_fillable_container<Container, Seq> &&
+                      std::constructible_from<Container, Args...>) {
+            auto c = Container(FLUX_FWD(args)...);
+            detail::bulk_fill(seq, c);
+            return c;
+        } else if constexpr (detail::direct_sequence_constructible<Container, Seq, Args...>) {
             return Container(FLUX_FWD(seq), FLUX_FWD(args)...);
         } else if constexpr (detail::from_sequence_constructible<Container, Seq, Args...>) {
             return Container(from_sequence, FLUX_FWD(seq), FLUX_FWD(args)...);
+        } else if constexpr (detail::hint_insertable<Container, Seq, Args...>) {
+            auto c = Container(FLUX_FWD(args)...);
+            detail::reserve_for_hint(c, flux::size_hint(seq));
+            detail::output_to_fn::write(seq, detail::make_inserter<element_t<Seq>>(c));
+            return c;
         } else if constexpr (detail::cpp17_range_constructible<Container, Seq, Args...>) {
             auto view_ = std::views::common(FLUX_FWD(seq));
             return Container(view_.begin(), view_.end(), FLUX_FWD(args)...);
         } else {
             auto c = Container(FLUX_FWD(args)...);
-            if constexpr (sized_sequence<Seq> && detail::reservable_container<Container>) {
-                c.reserve(flux::usize(seq));
+            if constexpr (detail::hint_reservable_container<Container>) {
+                detail::reserve_for_hint(c, flux::size_hint(seq));
             }
-            flux::output_to(seq, detail::make_inserter<element_t<Seq>>(c));
+            detail::output_to_fn::write(seq, detail::make_inserter<element_t<Seq>>(c));
             return c;
         }
     } else {
         static_assert(sequence<element_t<Seq>>);
-        return flux::to<Container>(flux::map(flux::from_fwd_ref(FLUX_FWD(seq)), [](auto&& elem) {
-            return flux::to<detail::container_value_t<Container>>(FLUX_FWD(elem));
-        }), FLUX_FWD(args)...);
+        using Inner = detail::container_value_t<Container>;
+        if constexpr (detail::has_inner_allocator<Inner, Args...>) {
+            // Inner containers which share the outer allocator can then be
+            // moved into place without reallocating
+            auto alloc = typename Inner::allocator_type(std::as_const(args)...);
+            return flux::to<Container>(flux::map(flux::from_fwd_ref(FLUX_FWD(seq)), [&alloc](auto&& elem) {
+                return flux::to<Inner>(FLUX_FWD(elem), alloc);
+            }), FLUX_FWD(args)...);
+        } else {
+            return flux::to<Container>(flux::map(flux::from_fwd_ref(FLUX_FWD(seq)), [](auto&& elem) {
+                return flux::to<Inner>(FLUX_FWD(elem));
+            }), FLUX_FWD(args)...);
+        }
     }
 }
 
@@ -163,18 +300,32 @@ constexpr auto to(Seq&& seq, Args&&... args)
 
 template <typename D>
 template <typename Container, typename... Args>
-constexpr auto inline_sequence_base<D>::to(Args&&... args) -> Container
+constexpr auto inline_sequence_base<D>::to(Args&&... args) & -> Container
 {
     return flux::to<Container>(derived(), FLUX_FWD(args)...);
 }
 
+template <typename D>
+template <typename Container, typename... Args>
+constexpr auto inline_sequence_base<D>::to(Args&&... args) && -> Container
+{
+    return flux::to<Container>(std::move(derived()), FLUX_FWD(args)...);
+}
+
 template <typename D>
 template <template <typename...> typename Container, typename... Args>
-constexpr auto inline_sequence_base<D>::to(Args&&... args)
+constexpr auto inline_sequence_base<D>::to(Args&&... args) &
 {
     return flux::to<Container>(derived(), FLUX_FWD(args)...);
 }
 
+template <typename D>
+template <template <typename...> typename Container, typename... Args>
+constexpr auto inline_sequence_base<D>::to(Args&&... args) &&
+{
+    return flux::to<Container>(std::move(derived()), FLUX_FWD(args)...);
+}
+
 } // namespace flux
 
 #endif // FLUX_OP_TO_HPP_INCLUDED
@@ -0,0 +1,42 @@
+
+// Copyright (c) 2023 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef FLUX_OP_TRANSFORM_INPLACE_HPP_INCLUDED
+#define FLUX_OP_TRANSFORM_INPLACE_HPP_INCLUDED
+
+#include <flux/op/for_each.hpp>
+
+namespace flux {
+
+namespace detail {
+
+struct transform_inplace_fn {
+    template <sequence Seq, typename Func>
+        requires std::invocable<Func&, element_t<Seq>> &&
+                 writable_sequence_of<Seq, std::invoke_result_t<Func&, element_t<Seq>>>
+    constexpr void operator()(Seq&& seq, Func func) const
+    {
+        flux::for_each(seq, [&func](auto&& elem) {
+            FLUX_FWD(elem) = std::invoke(func, static_cast<element_t<Seq>>(elem));
+        });
+    }
+};
+
+} // namespace detail
+
+FLUX_EXPORT inline constexpr auto transform_inplace = detail::transform_inplace_fn{};
+
+template <typename D>
+template <typename Func>
+    requires std::invocable<Func&, element_t<D>> &&
+             writable_sequence_of<D, std::invoke_result_t<Func&, element_t<D>>>
+constexpr void inline_sequence_base<D>::transform_inplace(Func func)
+{
+    flux::transform_inplace(derived(), std::move(func));
+}
+
+} // namespace flux
+
+#endif // FLUX_OP_TRANSFORM_INPLACE_HPP_INCLUDED
@@ -25,7 +25,7 @@ public:
     constexpr auto base() & -> Base& { return base_; }
     constexpr auto base() const& -> Base const& { return base_; }
 
-    struct flux_sequence_traits : passthrough_traits_base<Base> {
+    struct flux_sequence_traits : same_elements_traits_base<Base> {
 
         using value_type = value_t<Base>;
         static constexpr bool disable_multipass = !multipass_sequence<Base>;
@@ -0,0 +1,122 @@
+
+// Copyright (c) 2023 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef FLUX_OP_WRITE_BINARY_HPP_INCLUDED
+#define FLUX_OP_WRITE_BINARY_HPP_INCLUDED
+
+#include <flux/op/read_binary.hpp>
+#include <flux/op/write_to.hpp>
+
+namespace flux {
+
+namespace detail {
+
+template <typename OStream>
+struct ostream_sink {
+    OStream& os;
+
+    void write(char const* data, std::size_t n)
+    {
+        // ostreams don't set errno, so we can't say more than this
+        if (!os.write(data, static_cast<std::streamsize>(n)).good()) {
+            throw std::system_error(std::make_error_code(std::errc::io_error),
+                                    "flux::write_binary: ostream::write() failed");
+        }
+    }
+
+    void write2(char const* d1, std::size_t n1, char const* d2, std::size_t n2)
+    {
+        write(d1, n1);
+        write(d2, n2);
+    }
+};
+
+template <typename Out>
+auto make_binary_sink(Out& out)
+{
+    if constexpr (std::derived_from<Out, std::ostream>) {
+        return ostream_sink<Out>{out};
+    } else if constexpr (std::same_as<std::remove_const_t<Out>, std::FILE*>) {
+        FLUX_ASSERT(out != nullptr);
+        return stdio_sink{out};
+    }
+#if FLUX_HAVE_FD_WRITE_TO
+    else {
+        return fd_sink{out};
+    }
+#endif
+}
+
+// Streams must be non-const, but handles are copied into the sink so may be
+// const
+template <typename Out>
+concept binary_output = std::derived_from<Out, std::ostream> ||
+                        std::same_as<std::remove_const_t<Out>, std::FILE*>
+#if FLUX_HAVE_FD_WRITE_TO
+                        || std::same_as<std::remove_const_t<Out>, int>
+#endif
+                        ;
+
+template <typename Seq>
+concept binary_writable = sequence<Seq> && binary_record<value_t<Seq>> &&
+                          std::convertible_to<element_t<Seq>, value_t<Seq>>;
+
+template <typename Sink, typename Seq>
+void write_binary_impl(Sink& sink, Seq&& seq, bool swap_bytes)
+{
+    using T = value_t<Seq>;
+
+    // If the elements are already laid out in memory in the right order, we
+    // can hand them to the sink in one go
+    if constexpr (contiguous_sequence<Seq> && sized_sequence<Seq> &&
+                  std::same_as<std::remove_cvref_t<element_t<Seq>>, T>) {
+        if (!swap_bytes) {
+            sink.write(reinterpret_cast<char const*>(flux::data(seq)),
+                       static_cast<std::size_t>(flux::size(seq)) * sizeof(T));
+            return;
+        }
+    }
+
+    format_buffer<Sink> buf(sink);
+    flux::for_each(FLUX_FWD(seq), [&](auto&& elem) {
+        T value(FLUX_FWD(elem));
+        if constexpr (byte_swappable<T>) {
+            if (swap_bytes) {
+                value = detail::byteswap(value);
+            }
+        }
+        buf.write(std::string_view(reinterpret_cast<char const*>(std::addressof(value)),
+                                   sizeof(T)));
+    });
+    buf.flush();
+}
+
+struct write_binary_fn {
+    template <typename Seq, typename Out>
+        requires binary_writable<Seq> && binary_output<std::remove_reference_t<Out>>
+    auto operator()(Seq&& seq, Out&& out) const -> void
+    {
+        auto sink = detail::make_binary_sink(out);
+        detail::write_binary_impl(sink, FLUX_FWD(seq), false);
+    }
+
+    // Writes values with the given byte order
+    template <typename Seq, typename Out>
+        requires binary_writable<Seq> && binary_output<std::remove_reference_t<Out>> &&
+                 byte_swappable<value_t<Seq>>
+    auto operator()(Seq&& seq, Out&& out, std::endian order) const -> void
+    {
+        auto sink = detail::make_binary_sink(out);
+        detail::write_binary_impl(sink, FLUX_FWD(seq), order != std::endian::native);
+    }
+};
+
+} // namespace detail
+
+FLUX_EXPORT inline constexpr auto write_binary = detail::write_binary_fn{};
+
+} // namespace flux
+
+#endif // FLUX_OP_WRITE_BINARY_HPP_INCLUDED
@@ -1,4 +1,3 @@
-
 // Copyright (c) 2022 Tristan Brindle (tcbrindle at gmail dot com)
 // Distributed under the Boost Software License, Version 1.0. (See accompanying
 // file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
@@ -8,12 +7,291 @@
 
 #include <flux/op/for_each.hpp>
 
+#include <cerrno>
+#include <charconv>
+#include <cstdio>
+#include <cstring>
 #include <iosfwd>
+#include <memory>
+#include <string_view>
+#include <system_error>
+
+#if __has_include(<unistd.h>) && __has_include(<sys/uio.h>)
+#  define FLUX_HAVE_FD_WRITE_TO 1
+#  include <sys/uio.h>
+#  include <unistd.h>
+#else
+#  define FLUX_HAVE_FD_WRITE_TO 0
+#endif
 
 namespace flux {
 
+/*
+ * Controls how the buffered write_to() and format_to() lay out a sequence.
+ * The same options are used at every level of nesting.
+ */
+FLUX_EXPORT
+struct format_options {
+    std::string_view open = "[";
+    std::string_view close = "]";
+    std::string_view separator = ", ";
+};
+
 namespace detail {
 
+// Wide character types have no to_chars() overload, so they go via ostream
+template <typename T>
+concept fast_formattable_scalar =
+    (std::is_arithmetic_v<std::remove_cvref_t<T>> &&
+     !any_of<std::remove_cvref_t<T>, wchar_t, char8_t, char16_t, char32_t>) ||
+    std::convertible_to<T, std::string_view>;
+
+template <typename Seq>
+consteval auto is_fast_formattable() -> bool
+{
+    if constexpr (fast_formattable_scalar<Seq>) {
+        return true;
+    } else if constexpr (sequence<Seq>) {
+        return is_fast_formattable<element_t<Seq>>();
+    } else {
+        return false;
+    }
+}
+
+template <typename Seq>
+concept fast_formattable_sequence =
+    sequence<Seq> && is_fast_formattable<element_t<Seq>>();
+
+/*
+ * Accumulates formatted output in a large buffer and hands it to `Sink` in
+ * big blocks. Sink::write(char const*, size_t) must write everything it is
+ * given; Sink::write2(...) writes two blocks, which lets sinks with
+ * scatter/gather IO avoid copying large strings into the buffer.
+ */
+template <typename Sink>
+struct format_buffer {
+private:
+    static constexpr std::size_t capacity = 64 * 1024;
+
+    Sink& sink_;
+    std::unique_ptr<char[]> buf_ = std::make_unique_for_overwrite<char[]>(capacity);
+    std::size_t size_ = 0;
+
+public:
+    explicit format_buffer(Sink& sink) : sink_(sink) {}
+
+    format_buffer(format_buffer&&) = delete;
+
+    ~format_buffer() = default;
+
+    void flush()
+    {
+        if (size_ > 0) {
+            sink_.write(buf_.get(), size_);
+            size_ = 0;
+        }
+    }
+
+    void put(char c)
+    {
+        if (size_ == capacity) {
+            flush();
+        }
+        buf_[size_++] = c;
+    }
+
+    void write(std::string_view str)
+    {
+        if (str.size() <= capacity - size_) {
+            std::memcpy(buf_.get() + size_, str.data(), str.size());
+            size_ += str.size();
+        } else if (str.size() < capacity) {
+            flush();
+            std::memcpy(buf_.get(), str.data(), str.size());
+            size_ = str.size();
+        } else {
+            // Too big to be worth copying
+            sink_.write2(buf_.get(), size_, str.data(), str.size());
+            size_ = 0;
+        }
+    }
+
+    template <typename T>
+        requires std::is_arithmetic_v<T>
+    void write_number(T value)
+    {
+        // Enough for any integer, and for a floating point value in the
+        // general format with six significant digits
+        constexpr std::size_t max_chars = 64;
+        if (capacity - size_ < max_chars) {
+            flush();
+        }
+        char* const first = buf_.get() + size_;
+        char* const last = buf_.get() + capacity;
+        std::to_chars_result res;
+        if constexpr (std::is_floating_point_v<T>) {
+            // The same as operator<< with the default stream flags
+            res = std::to_chars(first, last, value, std::chars_format::general, 6);
+        } else {
+            res = std::to_chars(first, last, value);
+        }
+        FLUX_DEBUG_ASSERT(res.ec == std::errc{});
+        size_ = static_cast<std::size_t>(res.ptr - buf_.get());
+    }
+
+    // Writes a non-sequence element in the same way as operator<<
+    void write_scalar(auto const& elem)
+    {
+        using T = std::remove_cvref_t<decltype(elem)>;
+        if constexpr (any_of<T, char, signed char, unsigned char>) {
+            put(static_cast<char>(elem));
+        } else if constexpr (std::same_as<T, bool>) {
+            put(elem ? '1' : '0');
+        } else if constexpr (std::is_arithmetic_v<T>) {
+            write_number(elem);
+        } else {
+            write(std::string_view(elem));
+        }
+    }
+};
+
+// Writes to an ostream with operator<<, so that stream flags are respected
+template <typename OStream>
+struct ostream_writer {
+    OStream& os;
+
+    void write(std::string_view str) { os << str; }
+
+    void write_scalar(auto&& elem) { os << FLUX_FWD(elem); }
+};
+
+/*
+ * The formatting routine shared by every write_to() and format_to()
+ * overload, so that they all give the same output. Elements which are
+ * sequences (including strings) are written recursively, and everything
+ * else is passed to Writer::write_scalar().
+ */
+template <typename Writer>
+void format_nested(Writer& out, auto&& seq, format_options const& opts)
+{
+    using Seq = decltype(seq);
+
+    // With no separator, a string gives the same output as its characters,
+    // so we can write it in one go
+    if constexpr (contiguous_sequence<Seq> && sized_sequence<Seq> &&
+                  std::same_as<value_t<Seq>, char>) {
+        if (opts.separator.empty()) {
+            out.write(opts.open);
+            out.write(std::string_view(flux::data(seq), flux::usize(seq)));
+            out.write(opts.close);
+            return;
+        }
+    }
+
+    out.write(opts.open);
+    bool first = true;
+    flux::for_each(FLUX_FWD(seq), [&](auto&& elem) {
+        if (first) {
+            first = false;
+        } else {
+            out.write(opts.separator);
+        }
+
+        if constexpr (sequence<decltype(elem)>) {
+            detail::format_nested(out, FLUX_FWD(elem), opts);
+        } else {
+            out.write_scalar(FLUX_FWD(elem));
+        }
+    });
+    out.write(opts.close);
+}
+
+template <typename Sink>
+void format_sequence(Sink& sink, auto&& seq, format_options const& opts)
+{
+    format_buffer<Sink> buf(sink);
+    detail::format_nested(buf, FLUX_FWD(seq), opts);
+    buf.flush();
+}
+
+struct stdio_sink {
+    std::FILE* file;
+
+    void write(char const* data, std::size_t n)
+    {
+        if (std::fwrite(data, 1, n, file) != n) {
+            throw std::system_error(errno, std::generic_category(),
+                                    "flux::write_to: fwrite() failed");
+        }
+    }
+
+    void write2(char const* d1, std::size_t n1, char const* d2, std::size_t n2)
+    {
+        write(d1, n1);
+        write(d2, n2);
+    }
+};
+
+#if FLUX_HAVE_FD_WRITE_TO
+struct fd_sink {
+    int fd;
+
+    void write(char const* data, std::size_t n)
+    {
+        write2(data, n, nullptr, 0);
+    }
+
+    // Uses writev() so that large strings don't need to be copied into the
+    // buffer first
+    void write2(char const* d1, std::size_t n1, char const* d2, std::size_t n2)
+    {
+        ::iovec iov[2] = {{const_cast<char*>(d1), n1}, {const_cast<char*>(d2), n2}};
+        ::iovec* vec = iov;
+        int count = n2 > 0 ? 2 : 1;
+
+        while (count > 0) {
+            ::ssize_t res = ::writev(fd, vec, count);
+            if (res < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                throw std::system_error(errno, std::generic_category(),
+                                        "flux::write_to: writev() failed");
+            }
+            auto written = static_cast<std::size_t>(res);
+            while (count > 0 && written >= vec->iov_len) {
+                written -= vec->iov_len;
+                ++vec;
+                --count;
+            }
+            if (count > 0) {
+                vec->iov_base = static_cast<char*>(vec->iov_base) + written;
+                vec->iov_len -= written;
+            }
+        }
+    }
+};
+#endif
+
+template <typename OutIter>
+struct iterator_sink {
+    OutIter out;
+
+    void write(char const* data, std::size_t n)
+    {
+        for (std::size_t i = 0; i < n; ++i) {
+            *out = data[i];
+            ++out;
+        }
+    }
+
+    void write2(char const* d1, std::size_t n1, char const* d2, std::size_t n2)
+    {
+        write(d1, n1);
+        write(d2, n2);
+    }
+};
+
 struct write_to_fn {
 
     template <sequence Seq, typename OStream>
@@ -21,31 +299,49 @@ struct write_to_fn {
     auto operator()(Seq&& seq, OStream& os) const
         -> std::ostream&
     {
-        bool first = true;
-        os << '[';
+        ostream_writer<OStream> writer{os};
+        detail::format_nested(writer, FLUX_FWD(seq), format_options{});
+        return os;
+    }
 
-        flux::for_each(FLUX_FWD(seq), [&os, &first](auto&& elem) {
-            if (first) {
-                first = false;
-            } else {
-                os << ", ";
-            }
+    template <sequence Seq>
+        requires fast_formattable_sequence<Seq>
+    auto operator()(Seq&& seq, std::FILE* file, format_options const& opts = {}) const
+        -> void
+    {
+        FLUX_ASSERT(file != nullptr);
+        stdio_sink sink{file};
+        detail::format_sequence(sink, FLUX_FWD(seq), opts);
+    }
 
-            if constexpr (sequence<element_t<Seq>>) {
-                write_to_fn{}(FLUX_FWD(elem), os);
-            } else {
-                os << FLUX_FWD(elem);
-            }
-        });
+#if FLUX_HAVE_FD_WRITE_TO
+    template <sequence Seq>
+        requires fast_formattable_sequence<Seq>
+    auto operator()(Seq&& seq, int fd, format_options const& opts = {}) const
+        -> void
+    {
+        fd_sink sink{fd};
+        detail::format_sequence(sink, FLUX_FWD(seq), opts);
+    }
+#endif
+};
 
-        os << ']';
-        return os;
+struct format_to_fn {
+    template <sequence Seq, std::output_iterator<char const&> OutIter>
+        requires fast_formattable_sequence<Seq>
+    auto operator()(Seq&& seq, OutIter out, format_options const& opts = {}) const
+        -> OutIter
+    {
+        iterator_sink<OutIter> sink{std::move(out)};
+        detail::format_sequence(sink, FLUX_FWD(seq), opts);
+        return std::move(sink.out);
     }
 };
 
 } // namespace detail
 
 FLUX_EXPORT inline constexpr auto write_to = detail::write_to_fn{};
+FLUX_EXPORT inline constexpr auto format_to = detail::format_to_fn{};
 
 template <typename Derived>
 auto inline_sequence_base<Derived>::write_to(std::ostream& os) -> std::ostream&
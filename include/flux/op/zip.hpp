@@ -170,6 +170,17 @@ public:
         }, self.bases_);
     }
 
+    template <typename Self>
+        requires (sequence<const_like_t<Self, Bases>> && ...)
+    static constexpr auto size_hint(Self& self) -> size_bounds
+    {
+        return std::apply([](auto&... args) {
+            size_bounds res{std::numeric_limits<distance_t>::max()};
+            ((res = detail::size_bounds_min(res, flux::size_hint(args))), ...);
+            return res;
+        }, self.bases_);
+    }
+
     template <typename Self>
         requires (sequence<const_like_t<Self, Bases>> && ...)
     static constexpr auto move_at(Self& self, cursor_t<Self> const& cur)
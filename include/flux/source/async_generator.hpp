@@ -0,0 +1,291 @@
+
+// Copyright (c) 2023 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef FLUX_SOURCE_ASYNC_GENERATOR_HPP_INCLUDED
+#define FLUX_SOURCE_ASYNC_GENERATOR_HPP_INCLUDED
+
+#include <flux/source/generator.hpp>
+
+#include <coroutine>
+#include <exception>
+#include <functional>
+#include <optional>
+#include <utility>
+
+namespace flux {
+
+FLUX_EXPORT
+template <typename T = void>
+class task;
+
+FLUX_EXPORT
+class event_loop;
+
+namespace detail {
+
+template <typename T>
+struct task_result {
+    template <typename U = T>
+        requires std::convertible_to<U, T>
+    void return_value(U&& value)
+    {
+        value_.emplace(FLUX_FWD(value));
+    }
+
+    auto take_result() -> T { return std::move(*value_); }
+
+private:
+    std::optional<T> value_;
+};
+
+template <>
+struct task_result<void> {
+    void return_void() noexcept {}
+
+    void take_result() {}
+};
+
+} // namespace detail
+
+/*
+ * A lazily-started coroutine which produces a single value. Awaiting a task
+ * starts it, and the awaiting coroutine is resumed (by symmetric transfer)
+ * as soon as the task completes.
+ */
+template <typename T>
+class task {
+public:
+    struct promise_type;
+
+    using handle_type = std::coroutine_handle<promise_type>;
+
+private:
+    struct final_awaiter {
+        auto await_ready() noexcept -> bool { return false; }
+
+        auto await_suspend(handle_type handle) noexcept -> std::coroutine_handle<>
+        {
+            return handle.promise().continuation_;
+        }
+
+        void await_resume() noexcept {}
+    };
+
+public:
+    struct promise_type : detail::frame_allocating_promise, detail::task_result<T> {
+        auto get_return_object()
+        {
+            return task(handle_type::from_promise(*this));
+        }
+
+        auto initial_suspend() noexcept { return std::suspend_always{}; }
+
+        auto final_suspend() noexcept { return final_awaiter{}; }
+
+        void unhandled_exception() noexcept { exception_ = std::current_exception(); }
+
+    private:
+        friend class task;
+        friend class event_loop;
+
+        std::coroutine_handle<> continuation_ = std::noop_coroutine();
+        std::exception_ptr exception_;
+    };
+
+    struct awaiter {
+        handle_type coro;
+
+        auto await_ready() noexcept -> bool { return coro.done(); }
+
+        auto await_suspend(std::coroutine_handle<> awaiting) noexcept
+            -> std::coroutine_handle<>
+        {
+            coro.promise().continuation_ = awaiting;
+            return coro;
+        }
+
+        auto await_resume() -> T
+        {
+            if (coro.promise().exception_) {
+                std::rethrow_exception(coro.promise().exception_);
+            }
+            return coro.promise().take_result();
+        }
+    };
+
+    task(task&& other) noexcept
+        : coro_(std::exchange(other.coro_, {}))
+    {}
+
+    task& operator=(task&& other) noexcept
+    {
+        std::swap(coro_, other.coro_);
+        return *this;
+    }
+
+    ~task()
+    {
+        if (coro_) { coro_.destroy(); }
+    }
+
+    [[nodiscard]] auto done() const -> bool { return !coro_ || coro_.done(); }
+
+    auto operator co_await() const noexcept -> awaiter
+    {
+        FLUX_ASSERT(coro_ != nullptr);
+        return awaiter{coro_};
+    }
+
+private:
+    friend class event_loop;
+
+    handle_type coro_;
+
+    explicit task(handle_type handle) : coro_(handle) {}
+};
+
+/*
+ * Like generator, except that the coroutine body may also co_await. Elements
+ * are obtained one at a time with `co_await gen.next()`, which returns an
+ * optional reference to the yielded element, or an empty optional once the
+ * generator has finished.
+ */
+FLUX_EXPORT
+template <typename ElemT>
+class async_generator {
+public:
+    using yielded_type = std::conditional_t<std::is_reference_v<ElemT>,
+                                            ElemT,
+                                            ElemT const&>;
+
+    struct promise_type;
+
+    using handle_type = std::coroutine_handle<promise_type>;
+
+private:
+    // Both yielding and finishing hand control straight back to the
+    // coroutine which asked for the next element
+    struct consumer_awaiter {
+        auto await_ready() noexcept -> bool { return false; }
+
+        auto await_suspend(handle_type handle) noexcept -> std::coroutine_handle<>
+        {
+            return handle.promise().consumer_;
+        }
+
+        void await_resume() noexcept {}
+    };
+
+public:
+    struct promise_type : detail::frame_allocating_promise {
+        auto get_return_object()
+        {
+            return async_generator(handle_type::from_promise(*this));
+        }
+
+        auto initial_suspend() noexcept { return std::suspend_always{}; }
+
+        auto final_suspend() noexcept { return consumer_awaiter{}; }
+
+        auto yield_value(yielded_type elem) noexcept
+        {
+            ptr_ = std::addressof(elem);
+            return consumer_awaiter{};
+        }
+
+        void unhandled_exception() noexcept { exception_ = std::current_exception(); }
+
+        void return_void() noexcept {}
+
+    private:
+        friend class async_generator;
+
+        std::add_pointer_t<yielded_type> ptr_ = nullptr;
+        std::coroutine_handle<> consumer_ = std::noop_coroutine();
+        std::exception_ptr exception_;
+    };
+
+    struct next_awaiter {
+        handle_type coro;
+
+        auto await_ready() noexcept -> bool { return coro.done(); }
+
+        auto await_suspend(std::coroutine_handle<> consumer) noexcept
+            -> std::coroutine_handle<>
+        {
+            coro.promise().consumer_ = consumer;
+            return coro;
+        }
+
+        auto await_resume() -> flux::optional<std::remove_reference_t<yielded_type>&>
+        {
+            auto& promise = coro.promise();
+            if (promise.exception_) {
+                std::rethrow_exception(std::exchange(promise.exception_, nullptr));
+            }
+            if (coro.done()) {
+                return flux::nullopt;
+            }
+            return flux::optional<std::remove_reference_t<yielded_type>&>(*promise.ptr_);
+        }
+    };
+
+    async_generator(async_generator&& other) noexcept
+        : coro_(std::exchange(other.coro_, {}))
+    {}
+
+    async_generator& operator=(async_generator&& other) noexcept
+    {
+        std::swap(coro_, other.coro_);
+        return *this;
+    }
+
+    ~async_generator()
+    {
+        if (coro_) { coro_.destroy(); }
+    }
+
+    [[nodiscard]] auto next() -> next_awaiter
+    {
+        FLUX_ASSERT(coro_ != nullptr);
+        return next_awaiter{coro_};
+    }
+
+private:
+    handle_type coro_;
+
+    explicit async_generator(handle_type handle) : coro_(handle) {}
+};
+
+namespace detail {
+
+struct async_for_each_fn {
+private:
+    template <typename T, typename Func>
+    static auto impl(async_generator<T> gen, Func func) -> task<Func>
+    {
+        while (auto elem = co_await gen.next()) {
+            std::invoke(func, static_cast<typename async_generator<T>::yielded_type>(*elem));
+        }
+        co_return func;
+    }
+
+public:
+    template <typename T, typename Func>
+        requires std::invocable<Func&, typename async_generator<T>::yielded_type>
+    [[nodiscard]]
+    auto operator()(async_generator<T> gen, Func func) const -> task<Func>
+    {
+        return impl(std::move(gen), std::move(func));
+    }
+};
+
+} // namespace detail
+
+FLUX_EXPORT inline constexpr auto async_for_each = detail::async_for_each_fn{};
+
+} // namespace flux
+
+#endif // FLUX_SOURCE_ASYNC_GENERATOR_HPP_INCLUDED
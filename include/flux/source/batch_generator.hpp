@@ -0,0 +1,192 @@
+
+// Copyright (c) 2023 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef FLUX_SOURCE_BATCH_GENERATOR_HPP_INCLUDED
+#define FLUX_SOURCE_BATCH_GENERATOR_HPP_INCLUDED
+
+#include <flux/source/generator.hpp>
+
+#include <span>
+
+namespace flux {
+
+/*
+ * Like generator<T const&>, except that the coroutine may co_yield a whole
+ * contiguous block of elements at once. Consumers see a flat sequence of
+ * elements; the coroutine is only resumed when a block has been used up.
+ */
+FLUX_EXPORT
+template <typename T>
+    requires std::is_object_v<T>
+struct batch_generator : inline_sequence_base<batch_generator<T>> {
+
+    using block_type = std::span<T const>;
+
+    struct promise_type;
+
+    using handle_type = std::coroutine_handle<promise_type>;
+
+    struct promise_type : detail::frame_allocating_promise {
+        auto initial_suspend() { return std::suspend_always{}; }
+
+        auto final_suspend() noexcept { return std::suspend_always{}; }
+
+        auto get_return_object()
+        {
+            return batch_generator(handle_type::from_promise(*this));
+        }
+
+        // The yielded block (or element) lives until the coroutine is
+        // resumed, which only happens once the consumer is done with it
+        auto yield_value(block_type block)
+        {
+            block_ = block;
+            return std::suspend_always{};
+        }
+
+        auto yield_value(T const& elem)
+        {
+            block_ = block_type(std::addressof(elem), 1);
+            return std::suspend_always{};
+        }
+
+        auto unhandled_exception() { throw; }
+
+        void return_void() noexcept {}
+
+        block_type block_;
+    };
+
+private:
+    handle_type coro_;
+    T const* cur_ = nullptr;
+    T const* end_ = nullptr;
+
+    explicit batch_generator(handle_type&& handle) : coro_(std::move(handle)) {}
+
+    friend struct sequence_traits<batch_generator>;
+
+public:
+    batch_generator(batch_generator&& other) noexcept
+        : coro_(std::exchange(other.coro_, {})),
+          cur_(std::exchange(other.cur_, nullptr)),
+          end_(std::exchange(other.end_, nullptr))
+    {}
+
+    batch_generator& operator=(batch_generator&& other) noexcept
+    {
+        std::swap(coro_, other.coro_);
+        std::swap(cur_, other.cur_);
+        std::swap(end_, other.end_);
+        return *this;
+    }
+
+    ~batch_generator()
+    {
+        if (coro_) { coro_.destroy(); }
+    }
+};
+
+template <typename T>
+struct sequence_traits<batch_generator<T>>
+{
+private:
+    struct cursor_type {
+        cursor_type(cursor_type&&) = default;
+        cursor_type& operator=(cursor_type&&) = default;
+    private:
+        cursor_type() = default;
+        friend struct sequence_traits;
+    };
+
+    using self_t = batch_generator<T>;
+
+    // Writes the position reached back to the generator on destruction, so
+    // that elements which have already been consumed are not seen again if
+    // the consumer throws
+    struct position_guard {
+        T const*& dest;
+        T const*& ptr;
+
+        ~position_guard() { dest = ptr; }
+    };
+
+    // Resumes the coroutine until it yields a non-empty block or finishes
+    static void next_block(self_t& self)
+    {
+        do {
+            self.coro_.resume();
+            if (self.coro_.done()) {
+                self.cur_ = self.end_ = nullptr;
+                return;
+            }
+            auto block = self.coro_.promise().block_;
+            self.cur_ = block.data();
+            self.end_ = block.data() + block.size();
+        } while (self.cur_ == self.end_);
+    }
+
+public:
+    // Only starts a new block if the current one has been used up, so that
+    // restarting a partially consumed generator doesn't drop elements
+    static auto first(self_t& self) -> cursor_type
+    {
+        if (self.cur_ == self.end_ && !self.coro_.done()) {
+            next_block(self);
+        }
+        return cursor_type{};
+    }
+
+    static auto is_last(self_t& self, cursor_type const&) -> bool
+    {
+        return self.coro_.done();
+    }
+
+    static auto inc(self_t& self, cursor_type& cur) -> cursor_type&
+    {
+        if (++self.cur_ == self.end_) {
+            next_block(self);
+        }
+        return cur;
+    }
+
+    static auto read_at(self_t& self, cursor_type const&) -> T const&
+    {
+        return *self.cur_;
+    }
+
+    static auto for_each_while(self_t& self, auto&& pred) -> cursor_type
+    {
+        return for_each_while_from(self, first(self), pred);
+    }
+
+    // The position lives in the generator rather than the cursor, so we can
+    // always carry on from wherever we are
+    static auto for_each_while_from(self_t& self, cursor_type cur, auto&& pred) -> cursor_type
+    {
+        while (!self.coro_.done()) {
+            T const* ptr = self.cur_;
+            T const* const end = self.end_;
+            {
+                position_guard guard{self.cur_, ptr};
+                for (; ptr != end; ++ptr) {
+                    if (!std::invoke(pred, *ptr)) {
+                        break;
+                    }
+                }
+            }
+
+            if (ptr != end) {
+                return cur;
+            }
+            next_block(self);
+        }
+        return cur;
+    }
+};
+
+} // namespace flux
+
+#endif // FLUX_SOURCE_BATCH_GENERATOR_HPP_INCLUDED
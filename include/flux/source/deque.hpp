@@ -0,0 +1,166 @@
+
+// Copyright (c) 2023 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef FLUX_SOURCE_DEQUE_HPP_INCLUDED
+#define FLUX_SOURCE_DEQUE_HPP_INCLUDED
+
+#include <flux/core.hpp>
+
+#include <algorithm>
+#include <deque>
+#include <iterator>
+#include <memory>
+#include <span>
+
+namespace flux {
+
+/*
+ * Sequence implementation for std::deque
+ *
+ * The elements of a deque are stored in a series of fixed-size blocks. The
+ * standard doesn't let us ask where a block ends, so we find the first two
+ * by comparing the addresses of successive elements. The length of the
+ * second one (the first complete block) then tells us where each later block
+ * should end, and we only need to check the address of its last element. If
+ * that check fails we fall back to comparing addresses again, so we never
+ * hand out a segment which isn't contiguous. Each run of contiguous elements
+ * is passed to the caller as a std::span, so that we model segmented_sequence
+ * with every standard library.
+ */
+template <typename T, typename Alloc>
+struct sequence_traits<std::deque<T, Alloc>> {
+private:
+    // Number of elements from `iter` which are contiguous in memory, found
+    // by checking every address
+    static auto scan_block(auto iter, auto const end) -> distance_t
+    {
+        auto* const data = std::addressof(*iter);
+        distance_t len = 1;
+        while (++iter != end && std::addressof(*iter) == data + len) {
+            ++len;
+        }
+        return len;
+    }
+
+    template <typename Self>
+    static auto segments_from(Self& self, index_t idx, auto& pred) -> index_t
+    {
+        using segment_t = std::span<std::remove_reference_t<decltype(self[0])>>;
+
+        auto iter = self.begin() + idx;
+        auto const end = self.end();
+        distance_t block_sz = 0;
+        int n_blocks = 0;
+
+        while (iter != end) {
+            auto* const data = std::addressof(*iter);
+            distance_t const remaining = end - iter;
+            distance_t len = 0;
+
+            if (block_sz > 0) {
+                len = (std::min)(block_sz, remaining);
+                if (std::addressof(iter[len - 1]) != data + (len - 1)) {
+                    len = scan_block(iter, end);
+                }
+            } else {
+                len = scan_block(iter, end);
+                // The first block may be partly unused, so learn the block
+                // size from the second one, as long as it isn't also the last
+                if (++n_blocks == 2 && len < remaining) {
+                    block_sz = len;
+                }
+            }
+
+            segment_t segment(data, static_cast<std::size_t>(len));
+            distance_t const n = std::invoke(pred, segment);
+            if (n < len) {
+                return num::checked_add(idx, n);
+            }
+            idx = num::checked_add(idx, len);
+            iter += len;
+        }
+
+        return idx;
+    }
+
+public:
+    using value_type = T;
+
+    static auto first(auto&) -> index_t { return index_t{0}; }
+
+    static auto is_last(auto& self, index_t idx) -> bool { return idx >= size(self); }
+
+    static auto inc(auto& self, index_t& idx)
+    {
+        FLUX_DEBUG_ASSERT(idx < size(self));
+        idx = num::checked_add(idx, distance_t{1});
+    }
+
+    static auto read_at(auto& self, index_t idx) -> decltype(auto)
+    {
+        indexed_bounds_check(idx, size(self));
+        return self.begin()[idx];
+    }
+
+    static auto read_at_unchecked(auto& self, index_t idx) -> decltype(auto)
+    {
+        return self.begin()[idx];
+    }
+
+    static auto dec(auto&, index_t& idx)
+    {
+        FLUX_DEBUG_ASSERT(idx > 0);
+        idx = num::checked_sub(idx, distance_t{1});
+    }
+
+    static auto last(auto& self) -> index_t { return size(self); }
+
+    static auto inc(auto& self, index_t& idx, distance_t offset)
+    {
+        FLUX_DEBUG_ASSERT(num::checked_add(idx, offset) <= size(self));
+        FLUX_DEBUG_ASSERT(num::checked_add(idx, offset) >= 0);
+        idx = num::checked_add(idx, offset);
+    }
+
+    static auto distance(auto&, index_t from, index_t to) -> distance_t
+    {
+        return num::checked_sub(to, from);
+    }
+
+    static auto size(auto& self) -> distance_t
+    {
+        return checked_cast<distance_t>(self.size());
+    }
+
+    static auto for_each_segment_while(auto& self, auto&& pred) -> index_t
+    {
+        return segments_from(self, index_t{0}, pred);
+    }
+
+    static auto for_each_while(auto& self, auto&& pred) -> index_t
+    {
+        return for_each_while_from(self, index_t{0}, pred);
+    }
+
+    static auto for_each_while_from(auto& self, index_t idx, auto&& pred) -> index_t
+    {
+        FLUX_DEBUG_ASSERT(idx >= 0 && idx <= size(self));
+        auto elems_while = [&pred](auto& segment) -> distance_t {
+            distance_t i = 0;
+            for (auto&& elem : segment) {
+                if (!std::invoke(pred, elem)) {
+                    break;
+                }
+                ++i;
+            }
+            return i;
+        };
+        return segments_from(self, idx, elems_while);
+    }
+};
+
+} // namespace flux
+
+#endif // FLUX_SOURCE_DEQUE_HPP_INCLUDED
@@ -0,0 +1,250 @@
+
+// Copyright (c) 2023 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef FLUX_SOURCE_EVENT_LOOP_HPP_INCLUDED
+#define FLUX_SOURCE_EVENT_LOOP_HPP_INCLUDED
+
+#include <flux/source/array_ptr.hpp>
+#include <flux/source/async_generator.hpp>
+
+#if __has_include(<sys/epoll.h>) && __has_include(<unistd.h>)
+#  define FLUX_HAVE_EVENT_LOOP 1
+#else
+#  define FLUX_HAVE_EVENT_LOOP 0
+#endif
+
+#if FLUX_HAVE_EVENT_LOOP
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+#include <sys/epoll.h>
+#include <unistd.h>
+
+namespace flux {
+
+/*
+ * A minimal single-threaded event loop, which runs tasks until they are
+ * waiting for file descriptors to become ready and then waits for them with
+ * epoll. Regular files are always treated as ready. Only one coroutine may
+ * be waiting on any given file descriptor at a time.
+ */
+FLUX_EXPORT
+class event_loop {
+    int epfd_ = -1;
+    std::deque<std::coroutine_handle<>> ready_;
+    std::vector<task<>> tasks_;
+    std::size_t waiting_ = 0;
+
+    [[noreturn]] static void throw_errno(char const* what)
+    {
+        throw std::system_error(errno, std::generic_category(), what);
+    }
+
+    struct fd_awaiter {
+        event_loop& loop;
+        int fd;
+        std::uint32_t events;
+        std::coroutine_handle<> handle = nullptr;
+
+        auto await_ready() noexcept -> bool { return false; }
+
+        // Returns false, resuming immediately, for fds which epoll can't
+        // wait on (such as regular files, which are always readable)
+        auto await_suspend(std::coroutine_handle<> awaiting) -> bool
+        {
+            handle = awaiting;
+            ::epoll_event ev{};
+            ev.events = events | EPOLLONESHOT;
+            ev.data.ptr = this;
+
+            if (::epoll_ctl(loop.epfd_, EPOLL_CTL_MOD, fd, &ev) != 0) {
+                if (errno != ENOENT) {
+                    return fd_not_pollable();
+                }
+                if (::epoll_ctl(loop.epfd_, EPOLL_CTL_ADD, fd, &ev) != 0) {
+                    return fd_not_pollable();
+                }
+            }
+            ++loop.waiting_;
+            return true;
+        }
+
+        void await_resume() noexcept {}
+
+    private:
+        static auto fd_not_pollable() -> bool
+        {
+            if (errno == EPERM) {
+                return false;
+            }
+            throw_errno("flux::event_loop: epoll_ctl() failed");
+        }
+    };
+
+    struct schedule_awaiter {
+        event_loop& loop;
+
+        auto await_ready() noexcept -> bool { return false; }
+
+        void await_suspend(std::coroutine_handle<> awaiting)
+        {
+            loop.ready_.push_back(awaiting);
+        }
+
+        void await_resume() noexcept {}
+    };
+
+    void wait_for_events()
+    {
+        ::epoll_event events[64];
+        int n = ::epoll_wait(epfd_, events, 64, -1);
+        if (n < 0) {
+            if (errno == EINTR) {
+                return;
+            }
+            throw_errno("flux::event_loop: epoll_wait() failed");
+        }
+        for (int i = 0; i < n; i++) {
+            auto* waiter = static_cast<fd_awaiter*>(events[i].data.ptr);
+            --waiting_;
+            ready_.push_back(waiter->handle);
+        }
+    }
+
+public:
+    event_loop() : epfd_(::epoll_create1(EPOLL_CLOEXEC))
+    {
+        if (epfd_ < 0) {
+            throw_errno("flux::event_loop: epoll_create1() failed");
+        }
+    }
+
+    event_loop(event_loop&&) = delete;
+
+    ~event_loop()
+    {
+        // Destroy any unfinished tasks before closing the epoll fd
+        tasks_.clear();
+        ::close(epfd_);
+    }
+
+    // Adds a task to be run by the next call to run()
+    void spawn(task<> t)
+    {
+        FLUX_ASSERT(!t.done());
+        ready_.push_back(t.coro_);
+        tasks_.push_back(std::move(t));
+    }
+
+    /*
+     * Runs spawned tasks until they have all finished. If any of them exited
+     * with an exception, the first such exception is rethrown.
+     */
+    void run()
+    {
+        while (true) {
+            while (!ready_.empty()) {
+                auto handle = ready_.front();
+                ready_.pop_front();
+                handle.resume();
+            }
+            if (waiting_ == 0) {
+                break;
+            }
+            wait_for_events();
+        }
+
+        auto tasks = std::exchange(tasks_, {});
+        for (auto& t : tasks) {
+            if (!t.done()) {
+                runtime_error("flux::event_loop::run(): a task is waiting on "
+                              "something which the event loop cannot resume");
+            }
+        }
+        for (auto& t : tasks) {
+            if (t.coro_.promise().exception_) {
+                std::rethrow_exception(t.coro_.promise().exception_);
+            }
+        }
+    }
+
+    // Suspends the calling coroutine and lets other tasks run
+    [[nodiscard]] auto schedule() -> schedule_awaiter { return {*this}; }
+
+    [[nodiscard]] auto readable(int fd) -> fd_awaiter { return {*this, fd, EPOLLIN}; }
+
+    [[nodiscard]] auto writable(int fd) -> fd_awaiter { return {*this, fd, EPOLLOUT}; }
+
+    // Reads up to `size` bytes, returning 0 at end of file
+    auto read_some(int fd, char* buf, std::size_t size) -> task<std::size_t>
+    {
+        co_await readable(fd);
+        while (true) {
+            ::ssize_t res = ::read(fd, buf, size);
+            if (res >= 0) {
+                co_return static_cast<std::size_t>(res);
+            }
+            if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                co_await readable(fd);
+            } else if (errno != EINTR) {
+                throw_errno("flux::event_loop: read() failed");
+            }
+        }
+    }
+
+    auto write_all(int fd, std::string_view data) -> task<>
+    {
+        while (!data.empty()) {
+            co_await writable(fd);
+            ::ssize_t res = ::write(fd, data.data(), data.size());
+            if (res >= 0) {
+                data.remove_prefix(static_cast<std::size_t>(res));
+            } else if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+                throw_errno("flux::event_loop: write() failed");
+            }
+        }
+    }
+};
+
+namespace detail {
+
+struct async_read_chunks_fn {
+private:
+    static auto impl(event_loop& loop, int fd, std::size_t chunk_size)
+        -> async_generator<array_ptr<char const>>
+    {
+        auto buf = std::make_unique_for_overwrite<char[]>(chunk_size);
+        while (std::size_t n = co_await loop.read_some(fd, buf.get(), chunk_size)) {
+            co_yield make_array_ptr_unchecked(static_cast<char const*>(buf.get()),
+                                              static_cast<distance_t>(n));
+        }
+    }
+
+public:
+    [[nodiscard]]
+    auto operator()(event_loop& loop, int fd, std::size_t chunk_size = 64 * 1024) const
+        -> async_generator<array_ptr<char const>>
+    {
+        FLUX_ASSERT(chunk_size > 0);
+        return impl(loop, fd, chunk_size);
+    }
+};
+
+} // namespace detail
+
+FLUX_EXPORT inline constexpr auto async_read_chunks = detail::async_read_chunks_fn{};
+
+} // namespace flux
+
+#endif // FLUX_HAVE_EVENT_LOOP
+
+#endif // FLUX_SOURCE_EVENT_LOOP_HPP_INCLUDED
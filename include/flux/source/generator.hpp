@@ -8,11 +8,269 @@
 
 #include <flux/core.hpp>
 
+#include <array>
 #include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <memory_resource>
+#include <new>
 #include <utility>
 
 namespace flux {
 
+namespace detail {
+
+/*
+ * A per-thread cache of recently freed coroutine frames, bucketed by size.
+ * Frames which are too large for any bucket, or which arrive when their
+ * bucket is already full, go straight to the global operator new/delete.
+ */
+struct frame_pool {
+    static constexpr std::size_t granularity = 64;
+    static constexpr std::size_t num_buckets = 16;
+    static constexpr std::size_t max_cached = 64;
+
+    struct node {
+        node* next;
+    };
+
+    std::array<node*, num_buckets> free_lists_{};
+    std::array<std::size_t, num_buckets> counts_{};
+
+    frame_pool() = default;
+    frame_pool(frame_pool&&) = delete;
+
+    ~frame_pool();
+
+    static constexpr auto bucket_for(std::size_t bytes) -> std::size_t
+    {
+        return (bytes + granularity - 1) / granularity - 1;
+    }
+
+    auto allocate(std::size_t bytes) -> void*
+    {
+        auto const b = bucket_for(bytes);
+        if (b >= num_buckets) {
+            return ::operator new(bytes);
+        }
+        if (node* n = free_lists_[b]) {
+            free_lists_[b] = n->next;
+            --counts_[b];
+            return n;
+        }
+        return ::operator new((b + 1) * granularity);
+    }
+
+    auto deallocate(void* ptr, std::size_t bytes) noexcept -> void
+    {
+        auto const b = bucket_for(bytes);
+        if (b >= num_buckets || counts_[b] == max_cached) {
+            ::operator delete(ptr);
+            return;
+        }
+        free_lists_[b] = ::new (ptr) node{free_lists_[b]};
+        ++counts_[b];
+    }
+
+    // The number of frames currently held in the cache
+    auto cached_count() const noexcept -> std::size_t
+    {
+        std::size_t total = 0;
+        for (std::size_t n : counts_) {
+            total += n;
+        }
+        return total;
+    }
+};
+
+// Frames may be destroyed during thread exit after the pool has gone, in
+// which case they are freed directly
+inline thread_local bool frame_pool_destroyed = false;
+inline thread_local frame_pool local_frame_pool;
+
+inline frame_pool::~frame_pool()
+{
+    for (node* head : free_lists_) {
+        while (head) {
+            ::operator delete(std::exchange(head, head->next));
+        }
+    }
+    frame_pool_destroyed = true;
+}
+
+/*
+ * Allocation functions for coroutine frames. Every frame is followed by a
+ * pointer to the function which frees it, and then optionally by a copy of
+ * the allocator which was used to allocate it, so that the promise's
+ * operator delete (which only receives the frame size) can do the right
+ * thing.
+ */
+struct frame_allocation {
+    using dealloc_fn = void (*)(void* frame, std::size_t size) noexcept;
+
+    static constexpr auto round_up(std::size_t n, std::size_t align) -> std::size_t
+    {
+        return (n + align - 1) / align * align;
+    }
+
+    static constexpr auto fn_offset(std::size_t frame_size) -> std::size_t
+    {
+        return round_up(frame_size, alignof(dealloc_fn));
+    }
+
+    template <typename Alloc>
+    static constexpr auto alloc_offset(std::size_t frame_size) -> std::size_t
+    {
+        return round_up(fn_offset(frame_size) + sizeof(dealloc_fn), alignof(Alloc));
+    }
+
+    static auto set_dealloc_fn(void* frame, std::size_t frame_size, dealloc_fn fn) -> void
+    {
+        ::new (static_cast<std::byte*>(frame) + fn_offset(frame_size)) dealloc_fn(fn);
+    }
+
+    // Pooled allocation, used when the coroutine has no allocator argument
+
+    static auto pooled_size(std::size_t frame_size) -> std::size_t
+    {
+        return fn_offset(frame_size) + sizeof(dealloc_fn);
+    }
+
+    static auto allocate_pooled(std::size_t frame_size) -> void*
+    {
+        auto const bytes = pooled_size(frame_size);
+        void* frame = frame_pool_destroyed ? ::operator new(bytes)
+                                           : local_frame_pool.allocate(bytes);
+        set_dealloc_fn(frame, frame_size, &deallocate_pooled);
+        return frame;
+    }
+
+    static void deallocate_pooled(void* frame, std::size_t frame_size) noexcept
+    {
+        if (frame_pool_destroyed) {
+            ::operator delete(frame);
+        } else {
+            local_frame_pool.deallocate(frame, pooled_size(frame_size));
+        }
+    }
+
+    // Allocator-aware allocation
+
+    struct alignas(__STDCPP_DEFAULT_NEW_ALIGNMENT__) block {
+        std::byte bytes[__STDCPP_DEFAULT_NEW_ALIGNMENT__];
+    };
+
+    template <typename Alloc>
+    using block_alloc_t = typename std::allocator_traits<Alloc>::template rebind_alloc<block>;
+
+    template <typename Alloc>
+    static auto num_blocks(std::size_t frame_size) -> std::size_t
+    {
+        auto const bytes = alloc_offset<Alloc>(frame_size) + sizeof(Alloc);
+        return (bytes + sizeof(block) - 1) / sizeof(block);
+    }
+
+    template <typename Alloc>
+    static auto allocate_with(Alloc const& alloc, std::size_t frame_size) -> void*
+    {
+        block_alloc_t<Alloc> balloc(alloc);
+        void* frame = std::allocator_traits<block_alloc_t<Alloc>>::allocate(
+            balloc, num_blocks<Alloc>(frame_size));
+        ::new (static_cast<std::byte*>(frame) + alloc_offset<Alloc>(frame_size)) Alloc(alloc);
+        set_dealloc_fn(frame, frame_size, &deallocate_with<Alloc>);
+        return frame;
+    }
+
+    template <typename Alloc>
+    static void deallocate_with(void* frame, std::size_t frame_size) noexcept
+    {
+        auto* stored = std::launder(reinterpret_cast<Alloc*>(
+            static_cast<std::byte*>(frame) + alloc_offset<Alloc>(frame_size)));
+        block_alloc_t<Alloc> balloc(std::move(*stored));
+        stored->~Alloc();
+        std::allocator_traits<block_alloc_t<Alloc>>::deallocate(
+            balloc, static_cast<block*>(frame), num_blocks<Alloc>(frame_size));
+    }
+
+    static void deallocate(void* frame, std::size_t frame_size) noexcept
+    {
+        auto fn = *std::launder(reinterpret_cast<dealloc_fn*>(
+            static_cast<std::byte*>(frame) + fn_offset(frame_size)));
+        fn(frame, frame_size);
+    }
+};
+
+// A memory_resource* may be used in place of an allocator
+template <typename Alloc>
+auto to_frame_allocator(Alloc const& alloc)
+{
+    if constexpr (std::convertible_to<Alloc, std::pmr::memory_resource*>) {
+        return std::pmr::polymorphic_allocator<std::byte>(alloc);
+    } else {
+        return alloc;
+    }
+}
+
+template <typename Alloc>
+concept frame_allocator =
+    std::convertible_to<Alloc, std::pmr::memory_resource*> ||
+    requires (Alloc& a) {
+        typename Alloc::value_type;
+        a.allocate(std::size_t{});
+    };
+
+/*
+ * Base class for the promise types of flux's coroutine sequences. Frames are
+ * allocated from a thread-local pool by default. If the coroutine's first
+ * parameters (after the object parameter, for member functions) are
+ * std::allocator_arg followed by an allocator or a std::pmr::memory_resource*,
+ * that is used instead.
+ */
+struct frame_allocating_promise {
+    static auto operator new(std::size_t size) -> void*
+    {
+        return frame_allocation::allocate_pooled(size);
+    }
+
+    template <frame_allocator Alloc, typename... Args>
+    static auto operator new(std::size_t size, std::allocator_arg_t,
+                             Alloc const& alloc, Args const&...) -> void*
+    {
+        return frame_allocation::allocate_with(
+            to_frame_allocator(alloc), size);
+    }
+
+    template <typename This, frame_allocator Alloc, typename... Args>
+    static auto operator new(std::size_t size, This const&, std::allocator_arg_t,
+                             Alloc const& alloc, Args const&...) -> void*
+    {
+        return frame_allocation::allocate_with(
+            to_frame_allocator(alloc), size);
+    }
+
+    static void operator delete(void* ptr, std::size_t size) noexcept
+    {
+        frame_allocation::deallocate(ptr, size);
+    }
+};
+
+} // namespace detail
+
+/*
+ * Wraps a sequence so that `co_yield flux::elements_of(seq)` inside a
+ * generator yields each of its elements in turn. Nested generators of the
+ * same type are resumed directly rather than having each element re-yielded.
+ */
+FLUX_EXPORT
+template <typename Seq>
+struct elements_of {
+    Seq seq;
+};
+
+template <typename Seq>
+elements_of(Seq&&) -> elements_of<Seq&&>;
+
 FLUX_EXPORT
 template <typename ElemT>
 struct generator : inline_sequence_base<generator<ElemT>> {
@@ -25,27 +283,127 @@ struct generator : inline_sequence_base<generator<ElemT>> {
 
     using handle_type = std::coroutine_handle<promise_type>;
 
-    struct promise_type {
+private:
+    /*
+     * Nested generators form a stack. Every promise knows the root of the
+     * stack, and the root knows the innermost active generator (the leaf),
+     * so the consumer can always resume the leaf directly. When a nested
+     * generator finishes, it transfers control straight back to its parent.
+     */
+    struct final_awaiter {
+        auto await_ready() noexcept -> bool { return false; }
+
+        auto await_suspend(handle_type handle) noexcept -> std::coroutine_handle<>
+        {
+            auto& promise = handle.promise();
+            if (promise.parent_) {
+                promise.root_->leaf_ = promise.parent_;
+                return promise.parent_;
+            }
+            return std::noop_coroutine();
+        }
+
+        void await_resume() noexcept {}
+    };
+
+    struct nested_awaiter {
+        handle_type nested;
+
+        auto await_ready() noexcept -> bool { return !nested || nested.done(); }
+
+        auto await_suspend(handle_type handle) noexcept -> std::coroutine_handle<>
+        {
+            auto& parent = handle.promise();
+            auto& child = nested.promise();
+            child.parent_ = handle;
+            child.root_ = parent.root_;
+            parent.root_->leaf_ = nested;
+            return nested;
+        }
+
+        void await_resume()
+        {
+            if (nested && nested.promise().exception_) {
+                std::rethrow_exception(std::exchange(nested.promise().exception_, nullptr));
+            }
+        }
+    };
+
+    // Adapts any other sequence so it can be nested like a generator
+    template <typename Seq>
+    static auto yield_all(Seq& seq) -> generator
+    {
+        for (auto cur = flux::first(seq); !flux::is_last(seq, cur); flux::inc(seq, cur)) {
+            co_yield flux::read_at(seq, cur);
+        }
+    }
+
+public:
+    struct promise_type : detail::frame_allocating_promise {
         auto initial_suspend() { return std::suspend_always{}; }
 
-        auto final_suspend() noexcept { return std::suspend_always{}; }
+        auto final_suspend() noexcept { return final_awaiter{}; }
 
         auto get_return_object()
         {
+            leaf_ = handle_type::from_promise(*this);
             return generator(handle_type::from_promise(*this));
         }
 
         auto yield_value(yielded_type elem)
         {
-            ptr_ = std::addressof(elem);
+            root_->ptr_ = std::addressof(elem);
             return std::suspend_always{};
         }
 
-        auto unhandled_exception() { throw; }
+        template <typename Gen>
+            requires std::same_as<std::remove_cvref_t<Gen>, generator>
+        auto yield_value(elements_of<Gen> elems) noexcept
+        {
+            return nested_awaiter{elems.seq.coro_};
+        }
+
+        // The adapting generator lives in the awaiter, which lives in the
+        // nesting coroutine's frame until the co_yield completes
+        template <typename Seq>
+            requires (!std::same_as<std::remove_cvref_t<Seq>, generator>) &&
+                     sequence<Seq> &&
+                     std::convertible_to<element_t<Seq>, yielded_type>
+        auto yield_value(elements_of<Seq> elems)
+        {
+            struct owning_awaiter : nested_awaiter {
+                generator gen;
+
+                explicit owning_awaiter(generator&& g)
+                    : nested_awaiter{g.coro_}, gen(std::move(g))
+                {}
+            };
+
+            return owning_awaiter(yield_all(elems.seq));
+        }
+
+        // Exceptions in nested generators are rethrown in their parent, so
+        // that they can be handled there
+        void unhandled_exception()
+        {
+            if (parent_) {
+                exception_ = std::current_exception();
+            } else {
+                throw;
+            }
+        }
 
         void return_void() noexcept {}
 
         std::add_pointer_t<yielded_type> ptr_;
+
+    private:
+        friend struct generator;
+
+        promise_type* root_ = this;
+        handle_type leaf_;
+        handle_type parent_;
+        std::exception_ptr exception_;
     };
 
 private:
@@ -53,6 +411,8 @@ private:
 
     explicit generator(handle_type&& handle) : coro_(std::move(handle)) {}
 
+    void resume() { coro_.promise().leaf_.resume(); }
+
     friend struct sequence_traits<generator>;
 
 public:
@@ -88,7 +448,7 @@ private:
 
 public:
     static auto first(self_t& self) {
-        self.coro_.resume();
+        self.resume();
         return cursor_type{};
     }
 
@@ -99,7 +459,7 @@ public:
 
     static auto inc(self_t& self, cursor_type& cur) -> cursor_type&
     {
-        self.coro_.resume();
+        self.resume();
         return cur;
     }
 
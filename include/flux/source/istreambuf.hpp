@@ -10,7 +10,9 @@
 
 #include <flux/op/from.hpp>
 
+#include <cstddef>
 #include <iosfwd>
+#include <limits>
 
 namespace flux {
 
@@ -22,6 +24,45 @@ void derives_from_streambuf_test(std::basic_streambuf<CharT, Traits>&);
 template <typename T>
 concept derives_from_streambuf = requires (T& t) { derives_from_streambuf_test(t); };
 
+// Gives access to the (protected) get area of a streambuf, so that we can
+// iterate over buffered characters without a virtual call for each one
+template <typename CharT, typename Traits>
+struct streambuf_get_area : std::basic_streambuf<CharT, Traits> {
+    using Streambuf = std::basic_streambuf<CharT, Traits>;
+    using char_type = CharT;
+
+    static auto begin(Streambuf& buf) -> char_type*
+    {
+        return (buf.*&streambuf_get_area::gptr)();
+    }
+
+    static auto end(Streambuf& buf) -> char_type*
+    {
+        return (buf.*&streambuf_get_area::egptr)();
+    }
+
+    static void bump(Streambuf& buf, std::ptrdiff_t n)
+    {
+        constexpr std::ptrdiff_t max_bump = std::numeric_limits<int>::max();
+        while (n > max_bump) {
+            (buf.*&streambuf_get_area::gbump)(static_cast<int>(max_bump));
+            n -= max_bump;
+        }
+        (buf.*&streambuf_get_area::gbump)(static_cast<int>(n));
+    }
+
+    // Bumps the get pointer past the characters in [from, to) on
+    // destruction, so that characters which have already been consumed are
+    // not read again if the consumer throws
+    struct bump_guard {
+        Streambuf& buf;
+        char_type const* from;
+        char_type const*& to;
+
+        ~bump_guard() { bump(buf, to - from); }
+    };
+};
+
 struct from_istreambuf_fn {
     template <typename CharT, typename Traits>
     [[nodiscard]]
@@ -74,6 +115,55 @@ public:
     {
         return traits_type::to_char_type(self.sgetc());
     }
+
+    static auto for_each_while(Streambuf& self, auto&& pred) -> cursor_type
+    {
+        using get_area = detail::streambuf_get_area<char_type, traits_type>;
+
+        while (true) {
+            char_type const* const gbeg = get_area::begin(self);
+            char_type const* const gend = get_area::end(self);
+
+            if (gbeg == gend) {
+                // Refill the get area. Unbuffered streambufs may leave it
+                // empty, in which case we fall back to one char at a time.
+                auto c = self.sgetc();
+                if (c == traits_type::eof()) {
+                    break;
+                }
+                if (get_area::begin(self) == get_area::end(self)) {
+                    if (!std::invoke(pred, traits_type::to_char_type(c))) {
+                        break;
+                    }
+                    self.sbumpc();
+                }
+                continue;
+            }
+
+            char_type const* ptr = gbeg;
+            {
+                typename get_area::bump_guard guard{self, gbeg, ptr};
+                for (; ptr != gend; ++ptr) {
+                    if (!std::invoke(pred, char_type(*ptr))) {
+                        break;
+                    }
+                }
+            }
+
+            if (ptr != gend) {
+                break;
+            }
+        }
+
+        return cursor_type{};
+    }
+
+    // The cursor carries no state, so we can always resume from the current
+    // position
+    static auto for_each_while_from(Streambuf& self, cursor_type, auto&& pred) -> cursor_type
+    {
+        return for_each_while(self, pred);
+    }
 };
 
 FLUX_EXPORT
@@ -0,0 +1,250 @@
+
+// Copyright (c) 2023 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef FLUX_SOURCE_MMAP_FILE_HPP_INCLUDED
+#define FLUX_SOURCE_MMAP_FILE_HPP_INCLUDED
+
+#include <flux/core.hpp>
+
+#include <flux/source/array_ptr.hpp>
+
+#if __has_include(<sys/mman.h>) && __has_include(<sys/stat.h>) && \
+    __has_include(<fcntl.h>) && __has_include(<unistd.h>)
+#  define FLUX_HAVE_MMAP_FILE 1
+#else
+#  define FLUX_HAVE_MMAP_FILE 0
+#endif
+
+#if FLUX_HAVE_MMAP_FILE
+
+#include <cerrno>
+#include <cstdint>
+#include <filesystem>
+#include <system_error>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace flux {
+
+FLUX_EXPORT
+enum class mmap_advice {
+    normal,
+    sequential,
+    random,
+    willneed,
+    dontneed
+};
+
+/*
+ * An owning, read-only, contiguous sequence of the bytes of a file, which is
+ * mapped into memory for the lifetime of the object
+ */
+FLUX_EXPORT
+struct mmap_file : inline_sequence_base<mmap_file> {
+private:
+    char const* data_ = nullptr;
+    distance_t sz_ = 0;
+
+    [[noreturn]] static void throw_errno(char const* what)
+    {
+        throw std::system_error(errno, std::generic_category(), what);
+    }
+
+    static auto to_native(mmap_advice advice) -> int
+    {
+        switch (advice) {
+        case mmap_advice::sequential: return MADV_SEQUENTIAL;
+        case mmap_advice::random: return MADV_RANDOM;
+        case mmap_advice::willneed: return MADV_WILLNEED;
+        case mmap_advice::dontneed: return MADV_DONTNEED;
+        default: return MADV_NORMAL;
+        }
+    }
+
+    void unmap() noexcept
+    {
+        if (data_ != nullptr) {
+            ::munmap(const_cast<char*>(data_), static_cast<std::size_t>(sz_));
+        }
+        data_ = nullptr;
+        sz_ = 0;
+    }
+
+public:
+    mmap_file() = default;
+
+    explicit mmap_file(std::filesystem::path const& path,
+                       mmap_advice advice = mmap_advice::normal)
+    {
+        int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            throw_errno("flux::mmap_file: open() failed");
+        }
+
+        struct ::stat st{};
+        if (::fstat(fd, &st) != 0) {
+            int err = errno;
+            ::close(fd);
+            throw std::system_error(err, std::generic_category(),
+                                    "flux::mmap_file: fstat() failed");
+        }
+
+        // Mapping an empty file is an error, but an empty sequence isn't
+        if (st.st_size > 0) {
+            void* ptr = ::mmap(nullptr, static_cast<std::size_t>(st.st_size),
+                               PROT_READ, MAP_PRIVATE, fd, 0);
+            if (ptr == MAP_FAILED) {
+                int err = errno;
+                ::close(fd);
+                throw std::system_error(err, std::generic_category(),
+                                        "flux::mmap_file: mmap() failed");
+            }
+            data_ = static_cast<char const*>(ptr);
+            sz_ = checked_cast<distance_t>(st.st_size);
+        }
+
+        // The mapping remains valid after the descriptor is closed
+        ::close(fd);
+
+        if (advice != mmap_advice::normal) {
+            this->advise(advice);
+        }
+    }
+
+    mmap_file(mmap_file&& other) noexcept
+        : data_(std::exchange(other.data_, nullptr)),
+          sz_(std::exchange(other.sz_, 0))
+    {}
+
+    mmap_file& operator=(mmap_file&& other) noexcept
+    {
+        if (this != std::addressof(other)) {
+            unmap();
+            data_ = std::exchange(other.data_, nullptr);
+            sz_ = std::exchange(other.sz_, 0);
+        }
+        return *this;
+    }
+
+    ~mmap_file() { unmap(); }
+
+    /*
+     * Passes a hint about the expected access pattern to the kernel. This is
+     * advisory only, so failures are ignored.
+     */
+    void advise(mmap_advice advice) const noexcept
+    {
+        if (data_ != nullptr) {
+            ::madvise(const_cast<char*>(data_), static_cast<std::size_t>(sz_),
+                      to_native(advice));
+        }
+    }
+
+    /*
+     * Returns a view of the mapped bytes as an array of T. The size of the
+     * file must be a multiple of sizeof(T).
+     */
+    template <typename T>
+        requires std::is_trivially_copyable_v<T>
+    auto as() const -> array_ptr<T const>
+    {
+        if (sz_ % static_cast<distance_t>(sizeof(T)) != 0) {
+            runtime_error("flux::mmap_file::as(): file size is not a multiple of sizeof(T)");
+        }
+        // Mappings are page-aligned, so this can only fail for over-aligned types
+        FLUX_ASSERT(reinterpret_cast<std::uintptr_t>(data_) % alignof(T) == 0);
+        return make_array_ptr_unchecked(reinterpret_cast<T const*>(data_),
+                                        sz_ / static_cast<distance_t>(sizeof(T)));
+    }
+
+    struct flux_sequence_traits {
+
+        static constexpr auto first(mmap_file const&) -> index_t { return 0; }
+
+        static constexpr auto is_last(mmap_file const& self, index_t idx) -> bool
+        {
+            return idx >= self.sz_;
+        }
+
+        static constexpr auto inc(mmap_file const& self, index_t& idx) -> void
+        {
+            FLUX_DEBUG_ASSERT(idx < self.sz_);
+            idx = num::checked_add(idx, distance_t{1});
+        }
+
+        static constexpr auto read_at(mmap_file const& self, index_t idx) -> char const&
+        {
+            indexed_bounds_check(idx, self.sz_);
+            return self.data_[idx];
+        }
+
+        static constexpr auto read_at_unchecked(mmap_file const& self, index_t idx)
+            -> char const&
+        {
+            return self.data_[idx];
+        }
+
+        static constexpr auto dec(mmap_file const&, index_t& idx) -> void
+        {
+            FLUX_DEBUG_ASSERT(idx > 0);
+            --idx;
+        }
+
+        static constexpr auto last(mmap_file const& self) -> index_t { return self.sz_; }
+
+        static constexpr auto inc(mmap_file const& self, index_t& idx, distance_t offset)
+            -> void
+        {
+            index_t nxt = num::checked_add(idx, offset);
+            FLUX_DEBUG_ASSERT(nxt >= 0);
+            FLUX_DEBUG_ASSERT(nxt <= self.sz_);
+            idx = nxt;
+        }
+
+        static constexpr auto distance(mmap_file const&, index_t from, index_t to)
+            -> distance_t
+        {
+            return num::checked_sub(to, from);
+        }
+
+        static constexpr auto size(mmap_file const& self) -> distance_t
+        {
+            return self.sz_;
+        }
+
+        static constexpr auto data(mmap_file const& self) -> char const*
+        {
+            return self.data_;
+        }
+
+        static constexpr auto for_each_while(mmap_file const& self, auto&& pred)
+            -> index_t
+        {
+            return for_each_while_from(self, index_t{0}, pred);
+        }
+
+        static constexpr auto for_each_while_from(mmap_file const& self, index_t idx,
+                                                  auto&& pred) -> index_t
+        {
+            FLUX_DEBUG_ASSERT(idx >= 0 && idx <= self.sz_);
+            for (; idx < self.sz_; idx++) {
+                if (!std::invoke(pred, self.data_[idx])) {
+                    break;
+                }
+            }
+            return idx;
+        }
+    };
+};
+
+} // namespace flux
+
+#endif // FLUX_HAVE_MMAP_FILE
+
+#endif // FLUX_SOURCE_MMAP_FILE_HPP_INCLUDED
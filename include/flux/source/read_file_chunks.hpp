@@ -0,0 +1,235 @@
+
+// Copyright (c) 2023 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef FLUX_SOURCE_READ_FILE_CHUNKS_HPP_INCLUDED
+#define FLUX_SOURCE_READ_FILE_CHUNKS_HPP_INCLUDED
+
+#include <flux/core.hpp>
+
+#include <flux/source/array_ptr.hpp>
+
+#include <cerrno>
+#include <condition_variable>
+#include <cstdio>
+#include <exception>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <system_error>
+#include <thread>
+
+namespace flux {
+
+namespace detail {
+
+/*
+ * A single-pass source which reads a file in fixed-size blocks. A helper
+ * thread reads the next block into a second buffer while the current one
+ * is being processed, so that I/O overlaps with whatever the consumer is
+ * doing. Each element is a view of the current block, which is valid until
+ * the next call to inc().
+ */
+class file_chunk_reader : public inline_sequence_base<file_chunk_reader> {
+    struct buffer {
+        std::unique_ptr<char[]> data;
+        distance_t size = 0;
+        bool full = false; // owned by the consumer when true, the reader otherwise
+    };
+
+    struct shared_state {
+        std::FILE* file = nullptr;
+        distance_t chunk_size = 0;
+        std::mutex mtx;
+        std::condition_variable cv;
+        buffer bufs[2];
+        bool stop = false;
+        std::exception_ptr error;
+    };
+
+    std::unique_ptr<shared_state> state_;
+    std::thread reader_;
+    int current_ = 0;
+
+    friend struct sequence_traits<file_chunk_reader>;
+
+    // Runs on the helper thread
+    static void read_ahead(shared_state& st)
+    {
+        for (int idx = 0; ; idx ^= 1) {
+            buffer& buf = st.bufs[idx];
+            {
+                std::unique_lock lock(st.mtx);
+                st.cv.wait(lock, [&] { return st.stop || !buf.full; });
+                if (st.stop) {
+                    return;
+                }
+            }
+
+            std::size_t n = std::fread(buf.data.get(), 1,
+                                       static_cast<std::size_t>(st.chunk_size), st.file);
+            bool const failed = std::ferror(st.file) != 0;
+
+            {
+                std::lock_guard lock(st.mtx);
+                // A failed read is reported as an empty block, after which
+                // the consumer rethrows the error
+                buf.size = failed ? 0 : static_cast<distance_t>(n);
+                buf.full = true;
+                if (failed) {
+                    st.error = std::make_exception_ptr(std::system_error(
+                        errno != 0 ? errno : EIO, std::generic_category(),
+                        "flux::read_file_chunks: read failed"));
+                }
+            }
+            st.cv.notify_all();
+
+            if (failed || n == 0) {
+                return;
+            }
+        }
+    }
+
+    auto acquire(int idx) -> void
+    {
+        std::unique_lock lock(state_->mtx);
+        state_->cv.wait(lock, [&] { return state_->bufs[idx].full; });
+        if (state_->bufs[idx].size == 0 && state_->error) {
+            std::rethrow_exception(state_->error);
+        }
+    }
+
+    auto release(int idx) -> void
+    {
+        {
+            std::lock_guard lock(state_->mtx);
+            state_->bufs[idx].full = false;
+        }
+        state_->cv.notify_all();
+    }
+
+    auto shutdown() noexcept -> void
+    {
+        if (!state_) {
+            return;
+        }
+        {
+            std::lock_guard lock(state_->mtx);
+            state_->stop = true;
+        }
+        state_->cv.notify_all();
+        if (reader_.joinable()) {
+            reader_.join();
+        }
+        std::fclose(state_->file);
+        state_.reset();
+    }
+
+public:
+    file_chunk_reader(std::filesystem::path const& path, distance_t chunk_size)
+    {
+        FLUX_ASSERT(chunk_size > 0);
+
+        state_ = std::make_unique<shared_state>();
+        state_->chunk_size = chunk_size;
+        for (buffer& buf : state_->bufs) {
+            buf.data = std::make_unique_for_overwrite<char[]>(
+                static_cast<std::size_t>(chunk_size));
+        }
+
+        state_->file = std::fopen(path.string().c_str(), "rb");
+        if (state_->file == nullptr) {
+            throw std::system_error(errno, std::generic_category(),
+                                    "flux::read_file_chunks: could not open file");
+        }
+        // We always read whole blocks, so stdio buffering would just add a copy
+        std::setvbuf(state_->file, nullptr, _IONBF, 0);
+
+        try {
+            reader_ = std::thread(read_ahead, std::ref(*state_));
+        } catch (...) {
+            std::fclose(state_->file);
+            throw;
+        }
+    }
+
+    file_chunk_reader(file_chunk_reader&&) = default;
+
+    file_chunk_reader& operator=(file_chunk_reader&& other) noexcept
+    {
+        if (this != std::addressof(other)) {
+            shutdown();
+            state_ = std::move(other.state_);
+            reader_ = std::move(other.reader_);
+            current_ = other.current_;
+        }
+        return *this;
+    }
+
+    ~file_chunk_reader() { shutdown(); }
+};
+
+struct read_file_chunks_fn {
+    [[nodiscard]]
+    auto operator()(std::filesystem::path const& path,
+                    distance_t chunk_size = 1024 * 1024) const
+        -> file_chunk_reader
+    {
+        return file_chunk_reader(path, chunk_size);
+    }
+};
+
+} // namespace detail
+
+template <>
+struct sequence_traits<detail::file_chunk_reader> {
+private:
+    struct cursor_type {
+        cursor_type(cursor_type&&) = default;
+        cursor_type& operator=(cursor_type&&) = default;
+    private:
+        friend struct sequence_traits;
+        explicit cursor_type() = default;
+    };
+
+    using self_t = detail::file_chunk_reader;
+
+public:
+    using value_type = array_ptr<char const>;
+
+    static auto first(self_t& self) -> cursor_type
+    {
+        FLUX_ASSERT(self.state_ != nullptr);
+        self.current_ = 0;
+        self.acquire(0);
+        return cursor_type{};
+    }
+
+    static auto is_last(self_t& self, cursor_type const&) -> bool
+    {
+        return self.state_->bufs[self.current_].size == 0;
+    }
+
+    static auto read_at(self_t& self, cursor_type const&) -> array_ptr<char const>
+    {
+        auto const& buf = self.state_->bufs[self.current_];
+        return make_array_ptr_unchecked(static_cast<char const*>(buf.data.get()),
+                                        buf.size);
+    }
+
+    static auto inc(self_t& self, cursor_type& cur) -> cursor_type&
+    {
+        FLUX_DEBUG_ASSERT(!is_last(self, cur));
+        self.release(self.current_);
+        self.current_ ^= 1;
+        self.acquire(self.current_);
+        return cur;
+    }
+};
+
+FLUX_EXPORT inline constexpr auto read_file_chunks = detail::read_file_chunks_fn{};
+
+} // namespace flux
+
+#endif // FLUX_SOURCE_READ_FILE_CHUNKS_HPP_INCLUDED
@@ -2,34 +2,71 @@
 module;
 
 #include <array>
+#include <bit>
 #include <bitset>
+#include <cerrno>
+#include <charconv>
 #include <compare>
 #include <concepts>
+#include <condition_variable>
 #include <coroutine>
 #include <cstddef>
 #include <cstdint>
 #include <cstdio>
 #include <cstring>
+#include <deque>
 #include <exception>
+#include <filesystem>
 #include <functional>
 #include <initializer_list>
 #include <iosfwd>
 #include <iterator>
 #include <limits>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <new>
 #include <optional>
 #include <ranges>
 #include <source_location>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <system_error>
+#include <thread>
 #include <tuple>
 #include <type_traits>
 #include <utility>
 #include <variant>
+#include <vector>
 #include <version>
 
+#if __has_include(<sys/mman.h>) && __has_include(<sys/stat.h>) && \
+    __has_include(<fcntl.h>) && __has_include(<unistd.h>)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#if __has_include(<unistd.h>) && __has_include(<sys/uio.h>)
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+#if __has_include(<sys/epoll.h>) && __has_include(<unistd.h>)
+#include <sys/epoll.h>
+#include <unistd.h>
+#endif
+
 export module flux;
 
 #define FLUX_MODULE_INTERFACE
 
 #include <flux.hpp>
+#include <flux/op/par_text_chunks.hpp>
+#include <flux/source/deque.hpp>
+#include <flux/source/event_loop.hpp>
+#include <flux/source/mmap_file.hpp>
+#include <flux/source/read_file_chunks.hpp>
@@ -0,0 +1,238 @@
+
+// Copyright (c) 2023 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "catch.hpp"
+
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "test_utils.hpp"
+
+#ifndef USE_MODULES
+#include <flux/source/event_loop.hpp>
+#endif
+
+#if FLUX_HAVE_EVENT_LOOP
+
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace {
+
+using flux::async_generator;
+using flux::event_loop;
+using flux::task;
+
+auto numbers(event_loop& loop, int n) -> async_generator<int>
+{
+    for (int i = 0; i < n; i++) {
+        // Let other tasks run between elements
+        co_await loop.schedule();
+        co_yield i;
+    }
+}
+
+auto twice(int i) -> task<int>
+{
+    co_return i * 2;
+}
+
+auto doubled(async_generator<int> gen) -> async_generator<int>
+{
+    while (auto elem = co_await gen.next()) {
+        co_yield co_await twice(*elem);
+    }
+}
+
+auto throws_after(int n) -> async_generator<int>
+{
+    for (int i = 0; i < n; i++) {
+        co_yield i;
+    }
+    throw std::runtime_error("oops");
+}
+
+struct pipe_fds {
+    int read_end = -1;
+    int write_end = -1;
+
+    pipe_fds()
+    {
+        int fds[2];
+        REQUIRE(::pipe(fds) == 0);
+        read_end = fds[0];
+        write_end = fds[1];
+        ::fcntl(read_end, F_SETFL, O_NONBLOCK);
+        ::fcntl(write_end, F_SETFL, O_NONBLOCK);
+    }
+
+    void close_write_end()
+    {
+        ::close(std::exchange(write_end, -1));
+    }
+
+    ~pipe_fds()
+    {
+        ::close(read_end);
+        if (write_end >= 0) {
+            ::close(write_end);
+        }
+    }
+};
+
+auto write_in_pieces(event_loop& loop, pipe_fds& pipe, std::string const& data) -> task<>
+{
+    std::string_view rest = data;
+    while (!rest.empty()) {
+        auto piece = rest.substr(0, 1000);
+        co_await loop.write_all(pipe.write_end, piece);
+        rest.remove_prefix(piece.size());
+    }
+    pipe.close_write_end();
+}
+
+auto read_all(event_loop& loop, int fd, std::string& out) -> task<>
+{
+    co_await flux::async_for_each(flux::async_read_chunks(loop, fd, 4096),
+                                  [&out](flux::array_ptr<char const> chunk) {
+                                      out.append(chunk.data(),
+                                                 static_cast<std::size_t>(chunk.size()));
+                                  });
+}
+
+}
+
+TEST_CASE("async generator")
+{
+    SECTION("elements can be awaited one at a time")
+    {
+        event_loop loop;
+        std::vector<int> out;
+
+        loop.spawn([](event_loop& loop, std::vector<int>& out) -> task<> {
+            auto gen = numbers(loop, 5);
+            while (auto elem = co_await gen.next()) {
+                out.push_back(*elem);
+            }
+            // Asking again after the end is fine
+            CHECK(!(co_await gen.next()).has_value());
+        }(loop, out));
+
+        loop.run();
+        CHECK(out == std::vector{0, 1, 2, 3, 4});
+    }
+
+    SECTION("async generators can await tasks and other generators")
+    {
+        event_loop loop;
+        int sum = 0;
+
+        loop.spawn([](event_loop& loop, int& sum) -> task<> {
+            co_await flux::async_for_each(doubled(numbers(loop, 4)),
+                                          [&sum](int i) { sum += i; });
+        }(loop, sum));
+
+        loop.run();
+        CHECK(sum == 12);
+    }
+
+    SECTION("async_for_each returns the function object")
+    {
+        event_loop loop;
+        int count = 0;
+
+        loop.spawn([](event_loop& loop, int& count) -> task<> {
+            struct counter {
+                int n = 0;
+                void operator()(int) { ++n; }
+            };
+            auto c = co_await flux::async_for_each(numbers(loop, 7), counter{});
+            count = c.n;
+        }(loop, count));
+
+        loop.run();
+        CHECK(count == 7);
+    }
+
+    SECTION("tasks are interleaved on a single thread")
+    {
+        event_loop loop;
+        std::vector<int> order;
+
+        auto worker = [](event_loop& loop, std::vector<int>& order, int id) -> task<> {
+            co_await flux::async_for_each(numbers(loop, 3),
+                                          [&](int) { order.push_back(id); });
+        };
+
+        loop.spawn(worker(loop, order, 1));
+        loop.spawn(worker(loop, order, 2));
+        loop.run();
+
+        CHECK(order == std::vector{1, 2, 1, 2, 1, 2});
+    }
+
+    SECTION("exceptions propagate to the consumer, and out of run()")
+    {
+        event_loop loop;
+        std::vector<int> out;
+
+        loop.spawn([](std::vector<int>& out) -> task<> {
+            auto gen = throws_after(2);
+            while (auto elem = co_await gen.next()) {
+                out.push_back(*elem);
+            }
+        }(out));
+
+        CHECK_THROWS_AS(loop.run(), std::runtime_error);
+        CHECK(out == std::vector{0, 1});
+    }
+
+    SECTION("reading and writing pipes")
+    {
+        // Much bigger than a pipe buffer, so the writers and readers must
+        // take turns
+        std::string data1, data2;
+        for (int i = 0; i < 50'000; i++) {
+            data1 += std::to_string(i);
+            data2 += std::to_string(i * 7) + '\n';
+        }
+
+        pipe_fds pipe1, pipe2;
+        std::string out1, out2;
+
+        event_loop loop;
+        loop.spawn(read_all(loop, pipe1.read_end, out1));
+        loop.spawn(read_all(loop, pipe2.read_end, out2));
+        loop.spawn(write_in_pieces(loop, pipe1, data1));
+        loop.spawn(write_in_pieces(loop, pipe2, data2));
+        loop.run();
+
+        CHECK(out1 == data1);
+        CHECK(out2 == data2);
+    }
+
+    SECTION("reading regular files")
+    {
+        std::FILE* file = std::tmpfile();
+        REQUIRE(file != nullptr);
+        std::string data(100'000, 'x');
+        std::fwrite(data.data(), 1, data.size(), file);
+        std::fflush(file);
+        std::rewind(file);
+
+        event_loop loop;
+        std::string out;
+        loop.spawn(read_all(loop, ::fileno(file), out));
+        loop.run();
+        std::fclose(file);
+
+        CHECK(out == data);
+    }
+}
+
+#endif // FLUX_HAVE_EVENT_LOOP
@@ -0,0 +1,139 @@
+
+// Copyright (c) 2023 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "catch.hpp"
+
+#include <array>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "test_utils.hpp"
+
+namespace {
+
+using flux::batch_generator;
+
+// Yields [from, to) in blocks of up to block_size elements
+auto ints(int from, int to, int block_size) -> batch_generator<int>
+{
+    std::vector<int> buf;
+    while (from < to) {
+        buf.clear();
+        for (int i = 0; i < block_size && from < to; i++) {
+            buf.push_back(from++);
+        }
+        co_yield buf;
+    }
+}
+
+auto mixed() -> batch_generator<int>
+{
+    co_yield 1;
+    std::array arr{2, 3, 4};
+    co_yield arr;
+    co_yield std::span<int const>{};
+    co_yield 5;
+    co_yield std::span<int const>{};
+}
+
+auto nothing() -> batch_generator<int>
+{
+    co_yield std::span<int const>{};
+    co_return;
+}
+
+auto throwing() -> batch_generator<int>
+{
+    std::array arr{1, 2};
+    co_yield arr;
+    throw std::runtime_error("oops");
+}
+
+}
+
+TEST_CASE("batch generator")
+{
+    SECTION("basic batch_generator")
+    {
+        auto gen = ints(0, 10, 3);
+
+        static_assert(flux::sequence<decltype(gen)>);
+        static_assert(not flux::multipass_sequence<decltype(gen)>);
+        static_assert(std::same_as<flux::element_t<decltype(gen)>, int const&>);
+
+        CHECK(check_equal(std::move(gen), {0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+    }
+
+    SECTION("external iteration sees a flat sequence")
+    {
+        auto gen = ints(0, 7, 2);
+        std::vector<int> out;
+        for (auto cur = gen.first(); !gen.is_last(cur); gen.inc(cur)) {
+            out.push_back(gen[cur]);
+        }
+        CHECK(out == std::vector{0, 1, 2, 3, 4, 5, 6});
+    }
+
+    SECTION("single elements and empty blocks can be yielded")
+    {
+        CHECK(check_equal(mixed(), {1, 2, 3, 4, 5}));
+        CHECK(nothing().count() == 0);
+        CHECK(ints(0, 0, 4).count() == 0);
+    }
+
+    SECTION("internal iteration can stop part way through a block")
+    {
+        auto gen = ints(0, 100, 8);
+
+        auto cur = flux::find(gen, 13);
+        REQUIRE(!gen.is_last(cur));
+        CHECK(gen[cur] == 13);
+
+        // Carries on from where find() stopped
+        gen.inc(cur);
+        CHECK(flux::mut_ref(gen).take(5).sum() == 14 + 15 + 16 + 17 + 18);
+    }
+
+    SECTION("adaptors work with batch_generator")
+    {
+        auto evens = ints(0, 1000, 64).filter([](int i) { return i % 2 == 0; });
+        CHECK(std::move(evens).sum() == 249'500);
+
+        auto squares = ints(1, 5, 2).map([](int i) { return i * i; });
+        CHECK(check_equal(std::move(squares), {1, 4, 9, 16}));
+    }
+
+    SECTION("exceptions propagate to the consumer")
+    {
+        auto gen = throwing();
+        CHECK_THROWS_AS(gen.sum(), std::runtime_error);
+    }
+
+    SECTION("a throwing predicate leaves the generator at the element it threw on")
+    {
+        auto gen = ints(0, 20, 8);
+
+        CHECK_THROWS_AS(gen.for_each([](int i) {
+            if (i == 11) {
+                throw std::runtime_error("stop");
+            }
+        }), std::runtime_error);
+
+        CHECK(check_equal(std::move(gen), {11, 12, 13, 14, 15, 16, 17, 18, 19}));
+    }
+
+    SECTION("batch_generator can be moved")
+    {
+        auto gen = ints(0, 10, 4);
+        auto cur = gen.first();
+        gen.inc(cur);
+
+        auto gen2 = std::move(gen);
+        CHECK(gen2[cur] == 1);
+        gen2.inc(cur);
+        CHECK(gen2[cur] == 2);
+    }
+}
@@ -0,0 +1,81 @@
+
+// Copyright (c) 2022 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "catch.hpp"
+
+#include <array>
+
+#include "test_utils.hpp"
+
+namespace {
+
+constexpr auto always = [](auto const&...) { return true; };
+
+constexpr bool test_cartesian_power_filter()
+{
+    // cartesian_power_filter<0> is empty, like cartesian_power<0>
+    {
+        auto cart = flux::cartesian_power_filter<0>(std::tuple{}, std::array{1, 2, 3});
+        static_assert(std::is_same_v<flux::value_t<decltype(cart)>, std::tuple<>>);
+        STATIC_CHECK(cart.is_empty());
+    }
+
+    // 2-combinations of a sequence
+    {
+        auto cart = flux::cartesian_power_filter<2>(
+            std::tuple{always, [](char a, char b) { return a < b; }},
+            std::array{'a', 'b', 'c', 'd'});
+        using C = decltype(cart);
+
+        static_assert(flux::multipass_sequence<C>);
+        static_assert(flux::bounded_sequence<C>);
+        static_assert(not flux::sized_sequence<C>);
+        static_assert(std::same_as<flux::value_t<C>, std::tuple<char, char>>);
+
+        STATIC_CHECK(check_equal(cart, std::array{
+            std::tuple{'a', 'b'}, std::tuple{'a', 'c'}, std::tuple{'a', 'd'},
+            std::tuple{'b', 'c'}, std::tuple{'b', 'd'},
+            std::tuple{'c', 'd'}}));
+    }
+
+    // N-queens: rejecting a partial placement prunes all of its completions
+    {
+        auto safe = [](auto... cols) {
+            std::array<flux::distance_t, sizeof...(cols)> arr{cols...};
+            auto const n = arr.size() - 1;
+            for (std::size_t i = 0; i < n; ++i) {
+                auto const d = static_cast<flux::distance_t>(n - i);
+                if (arr[i] == arr[n] || arr[i] - arr[n] == d || arr[n] - arr[i] == d) {
+                    return false;
+                }
+            }
+            return true;
+        };
+
+        auto solutions = flux::cartesian_power_filter<6>(
+            std::tuple{safe, safe, safe, safe, safe, safe},
+            flux::ints(0, 6));
+
+        STATIC_CHECK(solutions.count() == 4);
+        STATIC_CHECK(solutions.front().value() == std::tuple{1, 3, 5, 0, 2, 4});
+
+        flux::distance_t n = 0;
+        for (auto cur = solutions.first(); !solutions.is_last(cur); solutions.inc(cur)) {
+            ++n;
+        }
+        STATIC_CHECK(n == 4);
+    }
+
+    return true;
+}
+static_assert(test_cartesian_power_filter());
+
+}
+
+TEST_CASE("cartesian power filter")
+{
+    bool res = test_cartesian_power_filter();
+    REQUIRE(res);
+}
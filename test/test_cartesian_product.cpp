@@ -464,6 +464,22 @@ constexpr bool test_cartesian_product()
         STATIC_CHECK(count == 2);
     }
 
+    // Internal iteration with random-access inner sequences returns the
+    // correct cursor when it stops early
+    {
+        auto cart = flux::cartesian_product(flux::ints(0, 3), flux::ints(0, 4),
+                                            std::array{10, 20, 30});
+
+        auto cur = flux::find_if(cart, flux::unpack([](auto i, auto j, int k) {
+            return i == 1 && j == 2 && k == 20;
+        }));
+        STATIC_CHECK(cur == std::tuple(1, 2, 1));
+        STATIC_CHECK(cart.distance(cart.first(), cur) == 12 + 6 + 1);
+
+        STATIC_CHECK(cart.is_last(flux::find_if(cart, flux::pred::false_)));
+        STATIC_CHECK(cart.count() == 3 * 4 * 3);
+    }
+
     // `cartesian_product` with a zero-sized sequence produces an empty sequence.
     {
         auto cart = flux::cartesian_product(std::array{1, 2, 3, 4, 5},
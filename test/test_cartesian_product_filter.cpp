@@ -0,0 +1,159 @@
+
+// Copyright (c) 2022 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "catch.hpp"
+
+#include <array>
+#include <vector>
+
+#include "test_utils.hpp"
+
+namespace {
+
+constexpr auto always = [](auto const&...) { return true; };
+
+constexpr bool test_cartesian_product_filter()
+{
+    // Only the last predicate filters: same as filtering the full product
+    {
+        std::array arr1{1, 2, 3};
+        std::array arr2{'a', 'b'};
+
+        auto cart = flux::cartesian_product_filter(
+            std::tuple{always, [](int i, char c) { return i != 2 || c == 'b'; }},
+            flux::ref(arr1), flux::ref(arr2));
+        using C = decltype(cart);
+
+        static_assert(flux::sequence<C>);
+        static_assert(flux::multipass_sequence<C>);
+        static_assert(not flux::bidirectional_sequence<C>);
+        static_assert(flux::bounded_sequence<C>);
+        static_assert(not flux::sized_sequence<C>);
+
+        static_assert(std::same_as<flux::element_t<C>, std::tuple<int const&, char const&>>);
+        static_assert(std::same_as<flux::value_t<C>, std::tuple<int, char>>);
+        static_assert(std::same_as<flux::rvalue_element_t<C>, std::tuple<int const&&, char const&&>>);
+
+        STATIC_CHECK(check_equal(cart, std::array{std::tuple{1, 'a'}, std::tuple{1, 'b'},
+                                                  std::tuple{2, 'b'},
+                                                  std::tuple{3, 'a'}, std::tuple{3, 'b'}}));
+
+        STATIC_CHECK(cart.count() == 5);
+        STATIC_CHECK(flux::next(cart, cart.first(), 5) == cart.last());
+    }
+
+    // Rejecting a prefix skips the whole inner dimension
+    {
+        int inner_calls = 0;
+
+        auto cart = flux::cartesian_product_filter(
+            std::tuple{[](int i) { return i % 2 == 0; },
+                       [&inner_calls](int, int) { ++inner_calls; return true; }},
+            flux::ints(0, 10), flux::ints(0, 100));
+
+        STATIC_CHECK(cart.count() == 5 * 100);
+        STATIC_CHECK(inner_calls == 5 * 100);
+
+        inner_calls = 0;
+        flux::distance_t n = 0;
+        for (auto cur = cart.first(); !cart.is_last(cur); cart.inc(cur)) {
+            ++n;
+        }
+        STATIC_CHECK(n == 5 * 100);
+        STATIC_CHECK(inner_calls == 5 * 100);
+    }
+
+    // Strictly increasing triples, with early termination
+    {
+        auto less = [](auto... xs) {
+            std::array arr{xs...};
+            return arr[arr.size() - 2] < arr[arr.size() - 1];
+        };
+
+        auto cart = flux::cartesian_product_filter(
+            std::tuple{always, less, less},
+            flux::ints(0, 4), flux::ints(0, 4), flux::ints(0, 4));
+
+        using T = std::tuple<flux::distance_t, flux::distance_t, flux::distance_t>;
+        std::array<T, 4> const expected{T{0, 1, 2}, T{0, 1, 3}, T{0, 2, 3}, T{1, 2, 3}};
+
+        STATIC_CHECK(check_equal(cart, expected));
+
+        // Internal and external iteration agree
+        std::array<T, 4> out{};
+        std::size_t i = 0;
+        cart.for_each([&](auto t) { out[i++] = t; });
+        STATIC_CHECK(out == expected);
+
+        auto cur = cart.find(T{0, 2, 3});
+        STATIC_CHECK(cart[cur] == T{0, 2, 3});
+        STATIC_CHECK(cart.next(cur) != cart.last());
+
+        STATIC_CHECK(cart.find(T{2, 2, 3}) == cart.last());
+    }
+
+    // Nothing satisfies the predicates
+    {
+        auto cart = flux::cartesian_product_filter(
+            std::tuple{always, [](int, int) { return false; }},
+            std::array{1, 2, 3}, std::array{1, 2, 3});
+
+        STATIC_CHECK(cart.is_empty());
+        STATIC_CHECK(cart.first() == cart.last());
+        STATIC_CHECK(cart.count() == 0);
+    }
+
+    // Empty inner sequence
+    {
+        auto cart = flux::cartesian_product_filter(
+            std::tuple{always, always},
+            std::array{1, 2, 3}, flux::empty<int>);
+
+        STATIC_CHECK(cart.is_empty());
+        STATIC_CHECK(cart.first() == cart.last());
+    }
+
+    // Single-pass first sequence
+    {
+        auto cart = flux::cartesian_product_filter(
+            std::tuple{[](int i) { return i != 2; }, always},
+            single_pass_only(flux::from(std::array{1, 2, 3})),
+            std::array{'a', 'b'});
+
+        static_assert(not flux::multipass_sequence<decltype(cart)>);
+
+        STATIC_CHECK(check_equal(cart, std::array{std::tuple{1, 'a'}, std::tuple{1, 'b'},
+                                                  std::tuple{3, 'a'}, std::tuple{3, 'b'}}));
+    }
+
+    return true;
+}
+static_assert(test_cartesian_product_filter());
+
+}
+
+TEST_CASE("cartesian product filter")
+{
+    bool res = test_cartesian_product_filter();
+    REQUIRE(res);
+
+    SECTION("matches filter over the full product")
+    {
+        std::vector<int> vec{3, 1, 4, 1, 5, 9, 2, 6};
+
+        auto pred = [](int a, int b, int c) { return a + b + c == 10; };
+
+        auto pruned = flux::cartesian_product_filter(
+            std::tuple{[](int a) { return a < 10; },
+                       [](int a, int b) { return a + b < 10; },
+                       pred},
+            flux::ref(vec), flux::ref(vec), flux::ref(vec));
+
+        auto filtered = flux::cartesian_product(flux::ref(vec), flux::ref(vec), flux::ref(vec))
+                            .filter(flux::unpack(pred));
+
+        CHECK(check_equal(pruned, filtered));
+    }
+}
@@ -0,0 +1,100 @@
+// Copyright (c) 2023 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "catch.hpp"
+
+#include <array>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "test_utils.hpp"
+
+namespace {
+
+using namespace std::string_view_literals;
+
+constexpr bool test_chunk_records()
+{
+    // Records within and across chunk boundaries
+    {
+        std::array chunks{"ab\ncd"sv, "ef\ng"sv, "h\n"sv};
+        auto seq = flux::chunk_records(flux::ref(chunks));
+        using S = decltype(seq);
+
+        static_assert(flux::sequence<S>);
+        static_assert(not flux::multipass_sequence<S>);
+        static_assert(std::same_as<flux::element_t<S>, std::string_view>);
+        static_assert(std::same_as<flux::value_t<S>, std::string_view>);
+
+        STATIC_CHECK(check_equal(seq, {"ab"sv, "cdef"sv, "gh"sv}));
+    }
+
+    // A record can span many chunks
+    {
+        std::array chunks{"a"sv, "b"sv, ""sv, "c"sv, "\nd"sv};
+        auto seq = flux::chunk_records(flux::ref(chunks));
+        STATIC_CHECK(check_equal(seq, {"abc"sv, "d"sv}));
+    }
+
+    // Empty records are preserved, but a trailing delimiter doesn't produce
+    // an extra one
+    {
+        std::array chunks{"\n"sv, "x\n"sv, "\n"sv};
+        auto seq = flux::chunk_records(flux::ref(chunks));
+        STATIC_CHECK(check_equal(seq, {""sv, "x"sv, ""sv}));
+    }
+
+    // Custom delimiters
+    {
+        std::array chunks{"1,2"sv, ",3"sv};
+        auto seq = flux::chunk_records(flux::ref(chunks), ',');
+        STATIC_CHECK(check_equal(seq, {"1"sv, "2"sv, "3"sv}));
+    }
+
+    // No chunks, or only empty chunks, means no records
+    {
+        std::array<std::string_view, 0> none{};
+        STATIC_CHECK(flux::chunk_records(flux::ref(none)).count() == 0);
+
+        std::array empties{""sv, ""sv};
+        STATIC_CHECK(flux::chunk_records(flux::ref(empties)).count() == 0);
+    }
+
+    // Chunks which are prvalues are kept alive while they're in use
+    {
+        std::array chunks{"ab\nc"sv, "d\ne"sv};
+        auto seq = flux::ref(chunks)
+                       .map([](std::string_view sv) { return std::string(sv); })
+                       .chunk_records();
+        STATIC_CHECK(check_equal(seq, {"ab"sv, "cd"sv, "e"sv}));
+    }
+
+    // Single-pass bases work too
+    {
+        std::array chunks{"a\nb"sv, "c\n"sv};
+        auto seq = flux::chunk_records(single_pass_only(flux::ref(chunks)));
+        STATIC_CHECK(check_equal(seq, {"a"sv, "bc"sv}));
+    }
+
+    return true;
+}
+static_assert(test_chunk_records());
+
+}
+
+TEST_CASE("chunk_records")
+{
+    bool res = test_chunk_records();
+    REQUIRE(res);
+
+    SECTION("records can be collected")
+    {
+        std::vector<std::string> chunks{"one\ntw", "o\nthr", "ee"};
+        auto records = flux::chunk_records(flux::ref(chunks))
+                           .map([](std::string_view sv) { return std::string(sv); })
+                           .to<std::vector<std::string>>();
+        REQUIRE(records == std::vector<std::string>{"one", "two", "three"});
+    }
+}
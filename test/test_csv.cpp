@@ -0,0 +1,175 @@
+// Copyright (c) 2023 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "catch.hpp"
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "test_utils.hpp"
+
+namespace {
+
+using namespace std::string_view_literals;
+
+using fields_t = std::vector<std::string>;
+
+auto to_vectors(auto&& seq) -> std::vector<fields_t>
+{
+    std::vector<fields_t> out;
+    FLUX_FOR(auto const& rec, seq) {
+        fields_t fields;
+        FLUX_FOR(std::string_view f, flux::ref(rec)) {
+            fields.emplace_back(f);
+        }
+        out.push_back(std::move(fields));
+    }
+    return out;
+}
+
+constexpr bool test_csv()
+{
+    // Simple records
+    {
+        auto seq = flux::csv("a,b,c\n1,2,3\n"sv);
+        using S = decltype(seq);
+
+        static_assert(flux::multipass_sequence<S>);
+        static_assert(flux::bounded_sequence<S>);
+        static_assert(not flux::bidirectional_sequence<S>);
+        static_assert(std::same_as<flux::element_t<S>, flux::csv_record>);
+
+        static_assert(flux::random_access_sequence<flux::csv_record>);
+        static_assert(flux::sized_sequence<flux::csv_record>);
+        static_assert(std::same_as<flux::element_t<flux::csv_record>, std::string_view>);
+
+        STATIC_CHECK(seq.count() == 2);
+
+        auto rec = seq.front().value();
+        STATIC_CHECK(rec.size() == 3);
+        STATIC_CHECK(check_equal(rec, {"a"sv, "b"sv, "c"sv}));
+        STATIC_CHECK(rec[2] == "c"sv);
+        STATIC_CHECK(rec.text() == "a,b,c"sv);
+    }
+
+    // Empty fields
+    {
+        auto rec = flux::csv(",x,,\n"sv).front().value();
+        STATIC_CHECK(check_equal(rec, {""sv, "x"sv, ""sv, ""sv}));
+    }
+
+    // Quoted fields have their quotes removed and may contain delimiters,
+    // newlines and doubled quotes
+    {
+        auto seq = flux::csv("\"a,b\",\"line1\nline2\",\"say \"\"hi\"\"\"\nnext\n"sv);
+        STATIC_CHECK(seq.count() == 2);
+
+        auto rec = seq.front().value();
+        STATIC_CHECK(check_equal(rec, {"a,b"sv, "line1\nline2"sv, "say \"hi\""sv}));
+
+        // Escaped fields can be read in any order
+        auto rec2 = seq.front().value();
+        STATIC_CHECK(rec2[2] == "say \"hi\""sv);
+        STATIC_CHECK(rec2[0] == "a,b"sv);
+    }
+
+    // CRLF line endings
+    {
+        auto seq = flux::csv("a,b\r\nc,d\r\n"sv);
+        STATIC_CHECK(seq.count() == 2);
+        STATIC_CHECK(check_equal(seq.front().value(), {"a"sv, "b"sv}));
+    }
+
+    // Quotes in the middle of unquoted fields are literal
+    {
+        auto seq = flux::csv("ab\"c,d\ne,f\n"sv);
+        STATIC_CHECK(seq.count() == 2);
+        STATIC_CHECK(check_equal(seq.front().value(), {"ab\"c"sv, "d"sv}));
+    }
+
+    // Custom delimiter and quote characters
+    {
+        auto seq = flux::csv("'x;y';z\n"sv, {.delimiter = ';', .quote = '\''});
+        STATIC_CHECK(check_equal(seq.front().value(), {"x;y"sv, "z"sv}));
+    }
+
+    // Empty input has no records, and a final record needs no newline
+    {
+        STATIC_CHECK(flux::csv(""sv).is_empty());
+        STATIC_CHECK(flux::csv("a,b"sv).count() == 1);
+    }
+
+    return true;
+}
+static_assert(test_csv());
+
+}
+
+TEST_CASE("csv")
+{
+    bool res = test_csv();
+    REQUIRE(res);
+
+    SECTION("many fields")
+    {
+        std::string line;
+        for (int i = 0; i < 40; ++i) {
+            line += (i == 0 ? "" : ",") + std::string(i % 3 == 0 ? "\"q\"\"" : "f") +
+                    std::to_string(i) + (i % 3 == 0 ? "\"" : "");
+        }
+        line += '\n';
+
+        auto recs = to_vectors(flux::csv(flux::ref(line)));
+        REQUIRE(recs.size() == 1);
+        REQUIRE(recs[0].size() == 40);
+        for (int i = 0; i < 40; ++i) {
+            auto expected = (i % 3 == 0 ? "q\"" : "f") + std::to_string(i);
+            REQUIRE(recs[0][i] == expected);
+        }
+    }
+
+    SECTION("records can be copied")
+    {
+        std::string const text = "\"a\"\"b\",c\n";
+        auto rec = flux::csv(flux::ref(text)).front().value();
+        auto copy = rec;
+        rec = flux::csv_record{};
+        REQUIRE(check_equal(copy, {"a\"b"sv, "c"sv}));
+    }
+
+    SECTION("fields are unescaped when they are read")
+    {
+        std::string const text = "\"a\"\"b\",c,\"d\"\"\"\"e\",\"f\"\"\"\n";
+        auto rec = flux::csv(flux::ref(text)).front().value();
+
+        // Fields may be read in any order, and earlier views stay valid as
+        // later fields are unescaped
+        std::string_view third = rec[2];
+        REQUIRE(third == "d\"\"e"sv);
+
+        // A copy keeps the fields which were already unescaped
+        auto copy = rec;
+        std::string_view copy_third = copy[2];
+        std::string_view copy_first = copy[0];
+        std::string_view copy_last = copy[3];
+        REQUIRE(copy_third == "d\"\"e"sv);
+        REQUIRE(copy_first == "a\"b"sv);
+        REQUIRE(copy_last == "f\""sv);
+
+        std::string_view first = rec[0];
+        REQUIRE(check_equal(rec, {"a\"b"sv, "c"sv, "d\"\"e"sv, "f\""sv}));
+        REQUIRE(third == "d\"\"e"sv);
+        REQUIRE(first == "a\"b"sv);
+
+        // Reading a field twice gives the same view
+        REQUIRE(rec[2].data() == third.data());
+    }
+
+    SECTION("unterminated quotes take the rest of the input")
+    {
+        auto recs = to_vectors(flux::csv("a,\"b\nc\n"sv));
+        REQUIRE(recs == std::vector<fields_t>{{"a", "b\nc\n"}});
+    }
+}
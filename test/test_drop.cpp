@@ -114,10 +114,130 @@ constexpr bool test_drop() {
         STATIC_CHECK(dropped.data() == arr.data() + 5);
     }
 
+    // internal iteration of dropped adaptors with their own for_each_while()
+    {
+        std::array<std::array<int, 3>, 3> nested{{{0, 1, 2}, {3, 4, 5}, {6, 7, 8}}};
+
+        auto flattened = flux::ref(nested).flatten().drop(4);
+
+        STATIC_CHECK(flattened.sum() == 5 + 6 + 7 + 8 + 4);
+        STATIC_CHECK(flattened[flattened.find(7)] == 7);
+        STATIC_CHECK(flattened.is_last(flattened.find(99)));
+
+        auto chained = flux::chain(std::array{0, 1, 2}, std::array{3, 4}, std::array{5, 6})
+                           .drop(2);
+
+        STATIC_CHECK(chained.sum() == 2 + 3 + 4 + 5 + 6);
+        STATIC_CHECK(chained[chained.find(5)] == 5);
+        STATIC_CHECK(chained.is_last(chained.find(0)));
+
+        auto product = flux::cartesian_product(std::array{1, 2, 3}, std::array{10, 20})
+                           .map([](auto t) { return std::get<0>(t) * std::get<1>(t); })
+                           .drop(3);
+
+        STATIC_CHECK(check_equal(product, {40, 30, 60}));
+        STATIC_CHECK(product.sum() == 40 + 30 + 60);
+
+        auto power = flux::cartesian_power<3>(std::array{0, 1})
+                         .map([](auto t) { return std::get<0>(t) * 4 + std::get<1>(t) * 2 + std::get<2>(t); })
+                         .drop(3);
+
+        STATIC_CHECK(power.sum() == 3 + 4 + 5 + 6 + 7);
+    }
+
+    // paging with drop() and take() uses internal iteration
+    {
+        auto page = flux::ints(0, 100).filter(flux::pred::even).drop(10).take(5);
+
+        STATIC_CHECK(check_equal(page, {20, 22, 24, 26, 28}));
+        STATIC_CHECK(page.sum() == 20 + 22 + 24 + 26 + 28);
+        STATIC_CHECK(page.count() == 5);
+    }
+
+    // internal iteration of single-pass sequences skips the dropped elements
+    {
+        auto dropped = single_pass_only(flux::from(std::array{0, 1, 2, 3, 4, 5}))
+                           .drop(2);
+
+        STATIC_CHECK(dropped.sum() == 2 + 3 + 4 + 5);
+    }
+
     return true;
 }
 static_assert(test_drop());
 
+constexpr bool test_slice_internal_iteration()
+{
+    std::array<std::array<int, 3>, 3> nested{{{0, 1, 2}, {3, 4, 5}, {6, 7, 8}}};
+    auto flat = flux::ref(nested).flatten();
+
+    // unbounded slice
+    {
+        auto slice = flux::slice(flat, flux::next(flat, flat.first(), 2), flux::last);
+
+        STATIC_CHECK(flux::sum(slice) == 2 + 3 + 4 + 5 + 6 + 7 + 8);
+        STATIC_CHECK(flux::read_at(slice, flux::find(slice, 6)) == 6);
+    }
+
+    // bounded slice, non-random-access
+    {
+        auto slice = flux::slice(flat, flux::next(flat, flat.first(), 2),
+                                 flux::next(flat, flat.first(), 7));
+
+        STATIC_CHECK(flux::sum(slice) == 2 + 3 + 4 + 5 + 6);
+        STATIC_CHECK(flux::is_last(slice, flux::find(slice, 7)));
+    }
+
+    // bounded slice, random-access
+    {
+        auto chained = flux::chain(std::array{0, 1, 2}, std::array{3, 4, 5});
+        auto slice = flux::slice(chained, flux::next(chained, chained.first(), 1),
+                                 flux::next(chained, chained.first(), 4));
+
+        STATIC_CHECK(flux::sum(slice) == 1 + 2 + 3);
+        STATIC_CHECK(flux::is_last(slice, flux::find(slice, 4)));
+        STATIC_CHECK(flux::read_at(slice, flux::find(slice, 3)) == 3);
+    }
+
+    // bounded slices and take() don't read the element after their end
+    {
+        std::array arr{0, 1, 2, 3, 4, 5};
+        int calls = 0;
+        auto count_calls = [&calls](int i) { ++calls; return i; };
+
+        auto mapped = flux::ref(arr).map(count_calls);
+        auto slice = flux::slice(mapped, 1, 3);
+
+        STATIC_CHECK(flux::sum(slice) == 1 + 2);
+        STATIC_CHECK(calls == 2);
+
+        calls = 0;
+        STATIC_CHECK(flux::is_last(slice, flux::find(slice, 99)));
+        STATIC_CHECK(calls == 2);
+
+        calls = 0;
+        auto taken = flux::ref(arr).map(count_calls).take(3);
+
+        STATIC_CHECK(taken.sum() == 0 + 1 + 2);
+        STATIC_CHECK(calls == 3);
+
+        calls = 0;
+        auto cur = taken.find(99);
+        STATIC_CHECK(taken.is_last(cur));
+        STATIC_CHECK(cur == taken.last());
+        STATIC_CHECK(calls == 3);
+
+        calls = 0;
+        auto paged = flux::ref(arr).map(count_calls).drop(1).take(2);
+
+        STATIC_CHECK(paged.sum() == 1 + 2);
+        STATIC_CHECK(calls == 2);
+    }
+
+    return true;
+}
+static_assert(test_slice_internal_iteration());
+
 constexpr bool issue_132a()
 {
     auto result = flux::from(std::array{1, 2})
@@ -156,6 +276,9 @@ TEST_CASE("drop")
     bool result = test_drop();
     REQUIRE(result);
 
+    result = test_slice_internal_iteration();
+    REQUIRE(result);
+
     // Test dropping a negative number of elements
     {
         std::list list{1, 2, 3, 4, 5};
@@ -259,6 +259,70 @@ bool issue_150()
 static_assert(issue_150());
 #endif
 
+
+#ifndef NO_CONSTEXPR_VECTOR
+constexpr
+#endif
+bool test_flatten_sized_inner()
+{
+    // With sized inner sequences, the size hint is exact
+    {
+        std::vector<std::vector<int>> vecs{{1, 2, 3}, {}, {4, 5}, {6}};
+
+        auto seq = flux::ref(vecs).flatten();
+
+        static_assert(not flux::sized_sequence<decltype(seq)>);
+        STATIC_CHECK(seq.size_hint().lower == 6);
+        STATIC_CHECK(seq.size_hint().upper.value() == 6);
+    }
+
+    // to() reserves exactly and copies the inner sequences one at a time
+    {
+        std::vector<std::vector<int>> vecs{{1, 2, 3}, {}, {4, 5}, {6}};
+
+        auto vec = flux::ref(vecs).flatten().to<std::vector<int>>();
+
+        STATIC_CHECK(check_equal(vec, {1, 2, 3, 4, 5, 6}));
+        STATIC_CHECK(vec.capacity() == 6);
+    }
+
+    // output_to() works segment-wise with contiguous iterators...
+    {
+        std::vector<std::vector<int>> vecs{{1, 2, 3}, {}, {4, 5}, {6}};
+        std::array<int, 8> arr{};
+
+        auto end = flux::ref(vecs).flatten().output_to(arr.begin());
+
+        STATIC_CHECK(end == arr.begin() + 6);
+        STATIC_CHECK(check_equal(arr, {1, 2, 3, 4, 5, 6, 0, 0}));
+    }
+
+    // ...and with back inserters, even to a different element type
+    {
+        std::vector<std::vector<int>> vecs{{1, 2, 3}, {}, {4, 5}, {6}};
+        std::vector<long> longs{0};
+
+        flux::ref(vecs).flatten().output_to(std::back_inserter(longs));
+
+        STATIC_CHECK(check_equal(longs, {0L, 1L, 2L, 3L, 4L, 5L, 6L}));
+    }
+
+    // Inner sequences which aren't sized give no upper bound
+    {
+        std::vector<std::vector<int>> vecs{{1, 2, 3}, {4, 5}};
+
+        auto filtered = flux::ref(vecs)
+                           .map([](auto& v) { return flux::ref(v).filter([](int) { return true; }); })
+                           .flatten();
+        STATIC_CHECK(filtered.size_hint().upper == flux::nullopt);
+    }
+
+    return true;
+}
+#ifndef NO_CONSTEXPR_VECTOR
+static_assert(test_flatten_sized_inner());
+#endif
+
 }
 
 TEST_CASE("flatten")
@@ -271,4 +335,7 @@ TEST_CASE("flatten")
 
     bool res = issue_150();
     REQUIRE(res);
+
+    bool sized = test_flatten_sized_inner();
+    REQUIRE(sized);
 }
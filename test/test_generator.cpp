@@ -8,8 +8,11 @@
 #include <algorithm>
 #include <coroutine>
 #include <memory>
+#include <memory_resource>
 #include <ranges>
+#include <stdexcept>
 #include <utility>
+#include <vector>
 
 #include "test_utils.hpp"
 
@@ -57,6 +60,102 @@ auto move_only() ->  generator<std::unique_ptr<int>&&>
     }
 }
 
+struct tree_node {
+    int value;
+    std::vector<tree_node> children;
+};
+
+auto walk(tree_node const& node) -> generator<int>
+{
+    co_yield node.value;
+    for (auto const& child : node.children) {
+        co_yield flux::elements_of(walk(child));
+    }
+}
+
+auto countdown(int n) -> generator<int>
+{
+    co_yield n;
+    if (n > 0) {
+        co_yield flux::elements_of(countdown(n - 1));
+    }
+}
+
+auto throws_after(int n) -> generator<int>
+{
+    for (int i = 0; i < n; i++) {
+        co_yield i;
+    }
+    throw std::runtime_error("nested");
+}
+
+// Counts the bytes currently allocated through it
+template <typename T>
+struct counting_allocator {
+    using value_type = T;
+
+    std::ptrdiff_t* live;
+
+    explicit counting_allocator(std::ptrdiff_t* l) : live(l) {}
+
+    template <typename U>
+    counting_allocator(counting_allocator<U> const& other) : live(other.live) {}
+
+    auto allocate(std::size_t n) -> T*
+    {
+        *live += static_cast<std::ptrdiff_t>(n * sizeof(T));
+        return std::allocator<T>{}.allocate(n);
+    }
+
+    void deallocate(T* ptr, std::size_t n)
+    {
+        *live -= static_cast<std::ptrdiff_t>(n * sizeof(T));
+        std::allocator<T>{}.deallocate(ptr, n);
+    }
+
+    friend bool operator==(counting_allocator const&, counting_allocator const&) = default;
+};
+
+// GCC 12 without optimisation wrongly warns that frames allocated by the
+// promise's allocator_arg operator new (which must be a template) are freed
+// by a mismatched operator delete. The warning is reported at the end of the
+// coroutine, so it can't be suppressed from inside generator.hpp.
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+template <typename Alloc>
+auto ints_with(std::allocator_arg_t, Alloc, int from, int to) -> generator<int>
+{
+    while (from < to) {
+        co_yield from++;
+    }
+}
+
+struct int_source {
+    int limit;
+
+    template <typename Alloc>
+    auto ints(std::allocator_arg_t, Alloc) const -> generator<int>
+    {
+        for (int i = 0; i < limit; i++) {
+            co_yield i;
+        }
+    }
+};
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+// Yields the address of a local which lives in the coroutine frame
+auto frame_address() -> generator<void const*>
+{
+    int local = 0;
+    co_yield static_cast<void const*>(&local);
+}
+
 }
 
 TEST_CASE("generator")
@@ -132,4 +231,139 @@ TEST_CASE("generator")
         CHECK((triples[triples.inc(cur)] == std::tuple{9, 12, 15}));
         CHECK((triples[triples.inc(cur)] == std::tuple{8, 15, 17}));
     }
+
+    SECTION("frames can be allocated with an allocator")
+    {
+        std::ptrdiff_t live = 0;
+        {
+            auto gen = ints_with(std::allocator_arg, counting_allocator<int>(&live), 0, 5);
+            CHECK(live > 0);
+            CHECK(check_equal(std::move(gen), {0, 1, 2, 3, 4}));
+        }
+        CHECK(live == 0);
+    }
+
+    SECTION("member coroutines can use allocators")
+    {
+        std::ptrdiff_t live = 0;
+        {
+            int_source src{3};
+            auto gen = src.ints(std::allocator_arg, counting_allocator<char>(&live));
+            CHECK(live > 0);
+            CHECK(check_equal(std::move(gen), {0, 1, 2}));
+        }
+        CHECK(live == 0);
+    }
+
+    SECTION("frames can be allocated from a memory_resource")
+    {
+        std::array<std::byte, 4096> buffer;
+        std::pmr::monotonic_buffer_resource res(buffer.data(), buffer.size(),
+                                                std::pmr::null_memory_resource());
+
+        auto gen = ints_with(std::allocator_arg, &res, 10, 13);
+        CHECK(check_equal(std::move(gen), {10, 11, 12}));
+
+        auto gen2 = ints_with(std::allocator_arg,
+                              std::pmr::polymorphic_allocator<>(&res), 1, 3);
+        CHECK(check_equal(std::move(gen2), {1, 2}));
+    }
+
+    SECTION("pooled frames are reused")
+    {
+        auto address_of = [](generator<void const*>& gen) {
+            auto cur = flux::first(gen);
+            return flux::read_at(gen, cur);
+        };
+
+        // The pool hands back the most recently freed frame of the same size
+        void const* first_addr = nullptr;
+        {
+            auto gen = frame_address();
+            first_addr = address_of(gen);
+        }
+        auto const& pool = flux::detail::local_frame_pool;
+        auto const cached = pool.cached_count();
+        {
+            auto gen = frame_address();
+            CHECK(address_of(gen) == first_addr);
+            CHECK(pool.cached_count() == cached - 1);
+        }
+        CHECK(pool.cached_count() == cached);
+
+        // Exercise the pool with many live and dead frames of the same size
+        std::vector<generator<int>> gens;
+        for (int round = 0; round < 3; round++) {
+            for (int i = 0; i < 100; i++) {
+                gens.push_back(::ints(i, i + 2));
+            }
+            for (int i = 0; i < 100; i++) {
+                CHECK(check_equal(std::move(gens[i]), {i, i + 1}));
+            }
+            gens.clear();
+        }
+    }
+
+    SECTION("elements_of a nested generator")
+    {
+        tree_node tree{1, {{2, {{3, {}}, {4, {}}}}, {5, {}}, {6, {{7, {{8, {}}}}}}}};
+        CHECK(check_equal(walk(tree), {1, 2, 3, 4, 5, 6, 7, 8}));
+    }
+
+    SECTION("elements_of an lvalue generator")
+    {
+        auto inner = ::ints(0, 3);
+        auto outer = [](generator<int>& gen) -> generator<int> {
+            co_yield flux::elements_of(gen);
+            co_yield 10;
+        };
+        CHECK(check_equal(outer(inner), {0, 1, 2, 10}));
+    }
+
+    SECTION("elements_of other sequences")
+    {
+        auto gen = []() -> generator<int> {
+            std::vector vec{1, 2, 3};
+            co_yield flux::elements_of(vec);
+            co_yield flux::elements_of(flux::iota(4, 6));
+            co_yield flux::elements_of(std::vector<int>{});
+            co_yield flux::elements_of(fib(0, 1).take(5));
+        }();
+
+        CHECK(check_equal(std::move(gen), {1, 2, 3, 4, 5, 0, 1, 1, 2, 3}));
+    }
+
+    SECTION("deeply nested generators")
+    {
+        CHECK(countdown(5000).count() == 5001);
+        CHECK(check_equal(countdown(3), {3, 2, 1, 0}));
+
+        // Stopping early destroys the whole stack of frames
+        CHECK(check_equal(countdown(1000).take(3), {1000, 999, 998}));
+    }
+
+    SECTION("exceptions from nested generators can be caught by the parent")
+    {
+        auto gen = []() -> generator<int> {
+            bool caught = false;
+            try {
+                co_yield flux::elements_of(throws_after(2));
+            } catch (std::runtime_error const&) {
+                caught = true;
+            }
+            co_yield caught ? -1 : -2;
+            co_yield 100;
+        }();
+
+        CHECK(check_equal(std::move(gen), {0, 1, -1, 100}));
+    }
+
+    SECTION("uncaught nested exceptions reach the consumer")
+    {
+        auto gen = []() -> generator<int> {
+            co_yield flux::elements_of(throws_after(3));
+        }();
+
+        CHECK_THROWS_AS(gen.count(), std::runtime_error);
+    }
 }
@@ -6,7 +6,10 @@
 #include "catch.hpp"
 
 #include <sstream>
+#include <streambuf>
+#include <stdexcept>
 #include <string>
+#include <string_view>
 
 #include "test_utils.hpp"
 
@@ -73,4 +76,123 @@ TEST_CASE("istreambuf")
         std::basic_streambuf<char, std::char_traits<char>>* ptr = nullptr;
         REQUIRE_THROWS_AS(flux::from_istreambuf(ptr), flux::unrecoverable_error);
     }
-}
\ No newline at end of file
+}
+namespace {
+
+// A streambuf which reads from a string through a small buffer, so that the
+// get area needs to be refilled several times
+struct small_buffer_streambuf : std::streambuf {
+    std::string_view src;
+    char buf[4]{};
+
+    explicit small_buffer_streambuf(std::string_view s) : src(s) {}
+
+    int_type underflow() override
+    {
+        if (src.empty()) {
+            return traits_type::eof();
+        }
+        auto n = src.copy(buf, sizeof(buf));
+        src.remove_prefix(n);
+        setg(buf, buf, buf + n);
+        return traits_type::to_int_type(buf[0]);
+    }
+};
+
+// A streambuf with no get area at all, which reads a character at a time
+struct unbuffered_streambuf : std::streambuf {
+    std::string_view src;
+
+    explicit unbuffered_streambuf(std::string_view s) : src(s) {}
+
+    int_type underflow() override
+    {
+        return src.empty() ? traits_type::eof() : traits_type::to_int_type(src.front());
+    }
+
+    int_type uflow() override
+    {
+        if (src.empty()) {
+            return traits_type::eof();
+        }
+        char c = src.front();
+        src.remove_prefix(1);
+        return traits_type::to_int_type(c);
+    }
+};
+
+template <typename Streambuf>
+void test_internal_iteration()
+{
+    constexpr std::string_view text = "the quick brown fox jumps over the lazy dog";
+
+    {
+        Streambuf buf(text);
+        REQUIRE(flux::from_istreambuf(&buf).template to<std::string>() == text);
+    }
+
+    {
+        Streambuf buf(text);
+        REQUIRE(flux::from_istreambuf(&buf).count_eq('o') == 4);
+    }
+
+    // Stopping early must not consume the remaining characters
+    {
+        Streambuf buf(text);
+        auto seq = flux::from_istreambuf(&buf);
+        auto cur = seq.find('j');
+        REQUIRE(!seq.is_last(cur));
+        REQUIRE(seq[cur] == 'j');
+
+        std::string rest;
+        FLUX_FOR(char c, seq) {
+            rest.push_back(c);
+        }
+        REQUIRE(rest == "jumps over the lazy dog");
+    }
+
+    {
+        Streambuf buf(text);
+        auto seq = flux::from_istreambuf(&buf);
+        auto cur = seq.find('!');
+        REQUIRE(seq.is_last(cur));
+    }
+
+    // If the predicate throws, the characters it accepted are still consumed
+    {
+        Streambuf buf(text);
+        auto seq = flux::from_istreambuf(&buf);
+
+        std::string seen;
+        REQUIRE_THROWS_AS(seq.for_each([&](char c) {
+            if (c == 'u') {
+                throw std::runtime_error("stop");
+            }
+            seen.push_back(c);
+        }), std::runtime_error);
+        REQUIRE(seen == "the q");
+
+        REQUIRE(seq.template to<std::string>() == "uick brown fox jumps over the lazy dog");
+    }
+}
+
+}
+
+TEST_CASE("istreambuf internal iteration")
+{
+    SECTION("stringbuf") {
+        std::istringstream iss(std::string(100'000, 'a') + "b");
+        auto seq = flux::from_istreambuf(iss);
+        auto cur = seq.find('b');
+        REQUIRE(!seq.is_last(cur));
+        REQUIRE(seq[cur] == 'b');
+        REQUIRE(seq.count() == 1);
+
+        iss.str(std::string(100'000, 'a'));
+        REQUIRE(flux::from_istreambuf(iss).count_eq('a') == 100'000);
+    }
+
+    SECTION("small buffer") { test_internal_iteration<small_buffer_streambuf>(); }
+
+    SECTION("unbuffered") { test_internal_iteration<unbuffered_streambuf>(); }
+}
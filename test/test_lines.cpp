@@ -0,0 +1,117 @@
+
+// Copyright (c) 2023 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "catch.hpp"
+
+#include <array>
+#include <string>
+#include <string_view>
+
+#include "test_utils.hpp"
+
+#ifndef USE_MODULES
+#include <flux/source/mmap_file.hpp>
+#endif
+
+namespace {
+
+using namespace std::string_view_literals;
+
+constexpr bool test_lines()
+{
+    // Basic lines
+    {
+        auto seq = flux::lines("Line1\nLine2\nLine3"sv);
+        using S = decltype(seq);
+
+        static_assert(flux::multipass_sequence<S>);
+        static_assert(flux::bidirectional_sequence<S>);
+        static_assert(flux::bounded_sequence<S>);
+        static_assert(not flux::random_access_sequence<S>);
+        static_assert(not flux::sized_sequence<S>);
+        static_assert(std::same_as<flux::element_t<S>, std::string_view>);
+        static_assert(std::same_as<flux::value_t<S>, std::string_view>);
+
+        STATIC_CHECK(check_equal(seq, {"Line1"sv, "Line2"sv, "Line3"sv}));
+        STATIC_CHECK(check_equal(flux::reverse(flux::ref(seq)),
+                                 {"Line3"sv, "Line2"sv, "Line1"sv}));
+    }
+
+    // A trailing newline doesn't produce an extra empty line
+    {
+        auto seq = flux::lines("a\nb\n"sv);
+        STATIC_CHECK(check_equal(seq, {"a"sv, "b"sv}));
+        STATIC_CHECK(check_equal(flux::reverse(flux::ref(seq)), {"b"sv, "a"sv}));
+    }
+
+    // Empty lines are preserved
+    {
+        auto seq = flux::lines("\n\na\n\n"sv);
+        STATIC_CHECK(check_equal(seq, {""sv, ""sv, "a"sv, ""sv}));
+        STATIC_CHECK(check_equal(flux::reverse(flux::ref(seq)), {""sv, "a"sv, ""sv, ""sv}));
+    }
+
+    // Empty input has no lines
+    {
+        auto seq = flux::lines(""sv);
+        STATIC_CHECK(seq.is_empty());
+        STATIC_CHECK(seq.first() == seq.last());
+    }
+
+    // A lone newline is one empty line
+    {
+        STATIC_CHECK(check_equal(flux::lines("\n"sv), {""sv}));
+    }
+
+    // \r is only stripped on request
+    {
+        auto str = "a\r\nb\r\n\r\nc"sv;
+        STATIC_CHECK(check_equal(flux::lines(str), {"a\r"sv, "b\r"sv, "\r"sv, "c"sv}));
+        STATIC_CHECK(check_equal(flux::lines(str, true), {"a"sv, "b"sv, ""sv, "c"sv}));
+        STATIC_CHECK(check_equal(flux::from(str).lines(true), {"a"sv, "b"sv, ""sv, "c"sv}));
+    }
+
+    // Works with array_ptr and other character types
+    {
+        std::array<char const, 5> arr{'x', '\n', 'y', '\n', 'z'};
+        auto ptr = flux::array_ptr(arr);
+        STATIC_CHECK(check_equal(flux::lines(ptr), {"x"sv, "y"sv, "z"sv}));
+
+        STATIC_CHECK(check_equal(flux::lines(u"one\ntwo"sv), {u"one"sv, u"two"sv}));
+    }
+
+    return true;
+}
+static_assert(test_lines());
+
+}
+
+TEST_CASE("lines")
+{
+    bool res = test_lines();
+    REQUIRE(res);
+
+    SECTION("std::string")
+    {
+        std::string str = "first\nsecond\r\nthird";
+        auto seq = flux::lines(flux::ref(str), true);
+        REQUIRE(check_equal(seq, {"first"sv, "second"sv, "third"sv}));
+
+        // The string views refer to the original string
+        REQUIRE(seq.front()->data() == str.data());
+    }
+
+#if FLUX_HAVE_MMAP_FILE
+    SECTION("mmap_file")
+    {
+        temp_file tmp("lines.txt", "alpha\nbeta\ngamma\n");
+
+        flux::mmap_file file(tmp.path);
+        REQUIRE(check_equal(flux::lines(flux::ref(file)),
+                            {"alpha"sv, "beta"sv, "gamma"sv}));
+        REQUIRE(flux::mmap_file(tmp.path).lines().count() == 3);
+    }
+#endif
+}
@@ -0,0 +1,134 @@
+
+// Copyright (c) 2023 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "catch.hpp"
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "test_utils.hpp"
+
+#ifndef USE_MODULES
+#include <flux/source/mmap_file.hpp>
+#endif
+
+#if FLUX_HAVE_MMAP_FILE
+
+TEST_CASE("mmap_file")
+{
+    static_assert(flux::contiguous_sequence<flux::mmap_file>);
+    static_assert(flux::sized_sequence<flux::mmap_file>);
+    static_assert(flux::bounded_sequence<flux::mmap_file>);
+    static_assert(flux::read_only_sequence<flux::mmap_file>);
+    static_assert(std::same_as<flux::element_t<flux::mmap_file>, char const&>);
+    static_assert(!std::copy_constructible<flux::mmap_file>);
+
+    temp_file tmp("lines.txt", "Line1\nLine2\nLine3");
+
+    SECTION("basic access")
+    {
+        flux::mmap_file file(tmp.path);
+
+        REQUIRE(file.size() == 17);
+        REQUIRE(file.data() != nullptr);
+        REQUIRE(check_equal(file, std::string_view("Line1\nLine2\nLine3")));
+
+        auto cur = file.find('\n');
+        REQUIRE(file.distance(file.first(), cur) == 5);
+    }
+
+    SECTION("split_string works on mapped files")
+    {
+        flux::mmap_file file(tmp.path, flux::mmap_advice::sequential);
+
+        auto lines = flux::split_string(flux::ref(file), '\n');
+        REQUIRE(check_equal(lines, std::array<std::string_view, 3>{"Line1", "Line2", "Line3"}));
+    }
+
+    SECTION("advice can be changed after mapping")
+    {
+        flux::mmap_file file(tmp.path);
+        file.advise(flux::mmap_advice::willneed);
+        file.advise(flux::mmap_advice::random);
+        REQUIRE(file.count_eq('L') == 3);
+    }
+
+    SECTION("move construction and assignment transfer the mapping")
+    {
+        flux::mmap_file file(tmp.path);
+        auto const* ptr = file.data();
+
+        flux::mmap_file file2(std::move(file));
+        REQUIRE(file2.data() == ptr);
+        REQUIRE(file.is_empty());
+
+        flux::mmap_file file3;
+        file3 = std::move(file2);
+        REQUIRE(file3.data() == ptr);
+        REQUIRE(file3.size() == 17);
+    }
+
+    SECTION("drop and slice use internal iteration")
+    {
+        flux::mmap_file file(tmp.path);
+
+        auto dropped = flux::ref(file).drop(6);
+        REQUIRE(dropped.count_eq('L') == 2);
+        REQUIRE(check_equal(flux::ref(file).drop(6).take(5), std::string_view("Line2")));
+
+        auto sliced = flux::slice(file, 12, 17);
+        REQUIRE(check_equal(sliced, std::string_view("Line3")));
+        REQUIRE(flux::is_last(sliced, flux::find(sliced, '\n')));
+    }
+
+    SECTION("output_to")
+    {
+        flux::mmap_file file(tmp.path);
+        std::string out(17, '\0');
+        flux::output_to(file, out.begin());
+        REQUIRE(out == "Line1\nLine2\nLine3");
+    }
+}
+
+TEST_CASE("mmap_file empty file")
+{
+    temp_file tmp("empty.txt");
+
+    flux::mmap_file file(tmp.path);
+    REQUIRE(file.is_empty());
+    REQUIRE(file.size() == 0);
+    REQUIRE(file.as<std::uint32_t>().is_empty());
+}
+
+TEST_CASE("mmap_file missing file")
+{
+    REQUIRE_THROWS_AS(flux::mmap_file(std::filesystem::temp_directory_path() / "flux_no_such_file"),
+                      std::system_error);
+}
+
+TEST_CASE("mmap_file typed view")
+{
+    std::array<std::uint32_t, 4> const records{1, 20, 300, 4000};
+    temp_file tmp("records.bin",
+                  std::string_view(reinterpret_cast<char const*>(records.data()),
+                                   sizeof(records)));
+
+    flux::mmap_file file(tmp.path);
+    auto view = file.as<std::uint32_t>();
+
+    static_assert(std::same_as<decltype(view), flux::array_ptr<std::uint32_t const>>);
+    REQUIRE(view.size() == 4);
+    REQUIRE(check_equal(view, records));
+
+    // The file size is not a multiple of sizeof(T)
+    using record3 = std::array<char, 3>;
+    REQUIRE_THROWS_AS(file.as<record3>(), flux::unrecoverable_error);
+}
+
+#endif // FLUX_HAVE_MMAP_FILE
@@ -0,0 +1,129 @@
+// Copyright (c) 2023 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "catch.hpp"
+
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "test_utils.hpp"
+
+#ifndef USE_MODULES
+#include <flux/op/par_text_chunks.hpp>
+#endif
+
+namespace {
+
+using parts_t = std::vector<std::string_view>;
+
+auto collect_parts(std::string_view text, char delim, flux::distance_t n_parts) -> parts_t
+{
+    return flux::par_text_chunks(
+        text, delim,
+        [](std::string_view part) { return parts_t{part}; },
+        [](parts_t acc, parts_t next) {
+            acc.insert(acc.end(), next.begin(), next.end());
+            return acc;
+        },
+        n_parts);
+}
+
+auto concat(parts_t const& parts) -> std::string
+{
+    std::string out;
+    for (auto part : parts) {
+        out += part;
+    }
+    return out;
+}
+
+}
+
+TEST_CASE("par_text_chunks")
+{
+    std::string text;
+    for (int i = 0; i < 1000; ++i) {
+        text += "record number " + std::to_string(i) + '\n';
+    }
+
+    SECTION("parts consist of complete records")
+    {
+        for (flux::distance_t n : {1, 2, 3, 7, 16, 64}) {
+            auto parts = collect_parts(text, '\n', n);
+
+            REQUIRE(parts.size() <= static_cast<std::size_t>(n));
+            REQUIRE(concat(parts) == text);
+            for (auto part : parts) {
+                REQUIRE(!part.empty());
+                REQUIRE(part.back() == '\n');
+            }
+        }
+    }
+
+    SECTION("parts are roughly equal in size")
+    {
+        auto parts = collect_parts(text, '\n', 4);
+        REQUIRE(parts.size() == 4);
+        for (auto part : parts) {
+            REQUIRE(part.size() > text.size() / 4 - 32);
+            REQUIRE(part.size() < text.size() / 4 + 32);
+        }
+    }
+
+    SECTION("unterminated final record")
+    {
+        std::string_view input = "a,bb,ccc,dddd";
+        auto parts = collect_parts(input, ',', 3);
+        REQUIRE(concat(parts) == input);
+        REQUIRE(parts.back().ends_with("dddd"));
+    }
+
+    SECTION("input with no delimiters is a single part")
+    {
+        std::string_view input = "no delimiters here";
+        auto parts = collect_parts(input, '\n', 8);
+        REQUIRE(parts == parts_t{input});
+    }
+
+    SECTION("more parts than bytes")
+    {
+        std::string_view input = "a\nb\n";
+        auto parts = collect_parts(input, '\n', 100);
+        REQUIRE(parts == parts_t{"a\n", "b\n"});
+    }
+
+    SECTION("empty input calls the function once")
+    {
+        int calls = 0;
+        auto res = flux::par_text_chunks(
+            std::string_view{}, '\n',
+            [&](std::string_view part) { ++calls; return part.size(); },
+            std::plus<>{});
+        REQUIRE(calls == 1);
+        REQUIRE(res == 0);
+    }
+
+    SECTION("counting records in parallel")
+    {
+        auto count = flux::par_text_chunks(
+            text, '\n',
+            [](std::string_view part) { return flux::lines(part).count(); },
+            std::plus<>{}, 8);
+        REQUIRE(count == 1000);
+    }
+
+    SECTION("exceptions are propagated")
+    {
+        auto throwing = [](std::string_view part) -> int {
+            if (part.find("record number 999") != std::string_view::npos) {
+                throw std::runtime_error("oops");
+            }
+            return 0;
+        };
+        REQUIRE_THROWS_AS(flux::par_text_chunks(text, '\n', throwing, std::plus<>{}, 4),
+                          std::runtime_error);
+    }
+}
@@ -0,0 +1,94 @@
+
+// Copyright (c) 2023 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "catch.hpp"
+
+#include <array>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "test_utils.hpp"
+
+using namespace std::string_view_literals;
+
+TEST_CASE("parse")
+{
+    SECTION("integers separated by whitespace")
+    {
+        auto seq = flux::parse<int>("  1 22\t-333\n4444  "sv);
+        using S = decltype(seq);
+
+        static_assert(flux::multipass_sequence<S>);
+        static_assert(flux::bounded_sequence<S>);
+        static_assert(not flux::bidirectional_sequence<S>);
+        static_assert(std::same_as<flux::element_t<S>, flux::optional<int>>);
+
+        REQUIRE(check_equal(std::move(seq).map([](auto o) { return o.value(); }),
+                            std::array{1, 22, -333, 4444}));
+    }
+
+    SECTION("custom delimiters collapse into a single separator")
+    {
+        auto seq = flux::parse<long>("10, 20,,30 ,40"sv, ", ");
+        REQUIRE(check_equal(std::move(seq).map([](auto o) { return o.value(); }),
+                            std::array{10L, 20L, 30L, 40L}));
+    }
+
+    SECTION("invalid tokens yield nullopt")
+    {
+        auto seq = flux::parse<int>("1 two 3x +4 99999999999 +-5 + ++6"sv);
+        std::vector<flux::optional<int>> vec = seq.to<std::vector>();
+
+        REQUIRE(vec.size() == 8);
+        REQUIRE(vec[0].value() == 1);
+        REQUIRE(!vec[1].has_value());
+        REQUIRE(!vec[2].has_value());
+        REQUIRE(vec[3].value() == 4);
+        REQUIRE(!vec[4].has_value()); // out of range
+        REQUIRE(!vec[5].has_value());
+        REQUIRE(!vec[6].has_value());
+        REQUIRE(!vec[7].has_value());
+
+#if FLUX_HAVE_FLOAT_FROM_CHARS
+        REQUIRE(!flux::parse<double>("+-1.5"sv).front()->has_value());
+#endif
+    }
+
+    SECTION("unsigned and narrow types")
+    {
+        REQUIRE(check_equal(flux::parse<unsigned char>("0 255"sv).map([](auto o) { return o.value(); }),
+                            std::array<unsigned char, 2>{0, 255}));
+        REQUIRE(!flux::parse<unsigned>("-1"sv).front()->has_value());
+    }
+
+#if FLUX_HAVE_FLOAT_FROM_CHARS
+    SECTION("floating point")
+    {
+        auto seq = flux::parse<double>("1.5 -2e3 0.25\n"sv);
+        REQUIRE(check_equal(std::move(seq).map([](auto o) { return o.value(); }),
+                            std::array{1.5, -2000.0, 0.25}));
+    }
+#endif
+
+    SECTION("empty input and input with only delimiters")
+    {
+        REQUIRE(flux::parse<int>(""sv).is_empty());
+        REQUIRE(flux::parse<int>(" \n\t "sv).is_empty());
+    }
+
+    SECTION("std::string and lines()")
+    {
+        std::string const str = "1 2 3\n4 5\n\n6\n";
+
+        REQUIRE(flux::parse<int>(flux::ref(str)).count() == 6);
+
+        auto row_sums = flux::lines(flux::ref(str)).map([](std::string_view line) {
+            return flux::parse<int>(line).map([](auto o) { return o.value(); }).sum();
+        });
+        REQUIRE(check_equal(row_sums, std::array{6, 9, 0, 6}));
+    }
+}
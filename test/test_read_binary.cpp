@@ -0,0 +1,108 @@
+// Copyright (c) 2023 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "catch.hpp"
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "test_utils.hpp"
+
+namespace {
+
+struct record {
+    std::int32_t id;
+    float value;
+
+    friend bool operator==(record const&, record const&) = default;
+};
+
+template <typename T>
+auto to_bytes(std::vector<T> const& vec) -> std::vector<char>
+{
+    std::vector<char> bytes(vec.size() * sizeof(T));
+    std::memcpy(bytes.data(), vec.data(), bytes.size());
+    return bytes;
+}
+
+}
+
+TEST_CASE("read_binary")
+{
+    SECTION("basic reading")
+    {
+        std::vector<record> const records{{1, 1.5f}, {2, 2.5f}, {3, 3.5f}};
+        auto bytes = to_bytes(records);
+
+        auto seq = flux::read_binary<record>(flux::ref(bytes));
+        using S = decltype(seq);
+
+        static_assert(flux::random_access_sequence<S>);
+        static_assert(flux::sized_sequence<S>);
+        static_assert(flux::bounded_sequence<S>);
+        static_assert(not flux::contiguous_sequence<S>);
+        static_assert(std::same_as<flux::element_t<S>, record>);
+        static_assert(std::same_as<flux::value_t<S>, record>);
+
+        REQUIRE(seq.size() == 3);
+        REQUIRE(check_equal(seq, records));
+        REQUIRE(seq[1] == record{2, 2.5f});
+        REQUIRE(check_equal(flux::reverse(flux::ref(seq)),
+                            std::vector<record>{{3, 3.5f}, {2, 2.5f}, {1, 1.5f}}));
+    }
+
+    SECTION("internal iteration")
+    {
+        std::vector<std::int64_t> const vals{10, 20, 30, 40};
+        auto bytes = to_bytes(vals);
+        REQUIRE(flux::read_binary<std::int64_t>(flux::ref(bytes)).sum() == 100);
+    }
+
+    SECTION("unaligned buffers can be read")
+    {
+        std::vector<std::uint32_t> const vals{0xdeadbeef, 0x12345678};
+        auto bytes = to_bytes(vals);
+        bytes.insert(bytes.begin(), 'x');
+
+        auto seq = flux::read_binary<std::uint32_t>(flux::drop(flux::ref(bytes), 1));
+        REQUIRE(check_equal(seq, vals));
+    }
+
+    SECTION("byte order conversion")
+    {
+        std::array<unsigned char, 8> const big{0x00, 0x00, 0x01, 0x02,
+                                               0xAA, 0xBB, 0xCC, 0xDD};
+
+        auto seq = flux::read_binary<std::uint32_t>(flux::ref(big), std::endian::big);
+        REQUIRE(check_equal(seq, std::array<std::uint32_t, 2>{0x0102, 0xAABBCCDD}));
+
+        auto little = flux::read_binary<std::uint16_t>(flux::ref(big), std::endian::little);
+        REQUIRE(little[1] == 0x0201);
+    }
+
+    SECTION("std::byte buffers")
+    {
+        std::array<std::byte, 4> buf{};
+        REQUIRE(flux::read_binary<std::int16_t>(flux::ref(buf)).size() == 2);
+    }
+
+    SECTION("size must be a multiple of sizeof(T)")
+    {
+        std::vector<char> bytes(7);
+        REQUIRE_THROWS_AS(flux::read_binary<std::int32_t>(flux::ref(bytes)),
+                          flux::unrecoverable_error);
+    }
+
+    SECTION("out of bounds reads are caught")
+    {
+        std::vector<char> bytes(8);
+        auto seq = flux::read_binary<std::int32_t>(flux::ref(bytes));
+        REQUIRE_THROWS_AS(seq[2], flux::unrecoverable_error);
+    }
+}
@@ -0,0 +1,113 @@
+// Copyright (c) 2023 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "catch.hpp"
+
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+#include "test_utils.hpp"
+
+#ifndef USE_MODULES
+#include <flux/source/read_file_chunks.hpp>
+#endif
+
+namespace {
+
+auto concat_chunks(auto&& reader) -> std::string
+{
+    std::string out;
+    FLUX_FOR(auto chunk, reader) {
+        out.append(chunk.data(), static_cast<std::size_t>(chunk.size()));
+    }
+    return out;
+}
+
+}
+
+TEST_CASE("read_file_chunks")
+{
+    using R = decltype(flux::read_file_chunks(std::filesystem::path{}));
+    static_assert(flux::sequence<R>);
+    static_assert(not flux::multipass_sequence<R>);
+    static_assert(std::same_as<flux::element_t<R>, flux::array_ptr<char const>>);
+    static_assert(not std::copy_constructible<R>);
+    static_assert(std::movable<R>);
+
+    SECTION("chunks cover the whole file")
+    {
+        std::string contents;
+        for (int i = 0; i < 10'000; ++i) {
+            contents += std::to_string(i);
+            contents += '\n';
+        }
+        temp_file tmp("chunks.txt", contents);
+
+        auto reader = flux::read_file_chunks(tmp.path, 1000);
+
+        std::vector<flux::distance_t> sizes;
+        std::string out;
+        FLUX_FOR(auto chunk, reader) {
+            sizes.push_back(chunk.size());
+            out.append(chunk.data(), static_cast<std::size_t>(chunk.size()));
+        }
+
+        REQUIRE(out == contents);
+        REQUIRE(sizes.size() == (contents.size() + 999) / 1000);
+        for (std::size_t i = 0; i + 1 < sizes.size(); ++i) {
+            REQUIRE(sizes[i] == 1000);
+        }
+    }
+
+    SECTION("file size is a multiple of the chunk size")
+    {
+        temp_file tmp("exact.txt", "abcdefgh");
+        REQUIRE(concat_chunks(flux::read_file_chunks(tmp.path, 4)) == "abcdefgh");
+        REQUIRE(flux::read_file_chunks(tmp.path, 4).count() == 2);
+    }
+
+    SECTION("empty file")
+    {
+        temp_file tmp("empty.txt");
+        REQUIRE(flux::read_file_chunks(tmp.path).count() == 0);
+    }
+
+    SECTION("abandoning the reader early")
+    {
+        temp_file tmp("early.txt", std::string(100'000, 'x'));
+        auto reader = flux::read_file_chunks(tmp.path, 10);
+        auto cur = reader.first();
+        REQUIRE(reader.read_at(cur).size() == 10);
+        // The destructor must stop the helper thread
+    }
+
+    SECTION("moving the reader")
+    {
+        temp_file tmp("move.txt", "hello world");
+        auto reader = flux::read_file_chunks(tmp.path, 3);
+        auto moved = std::move(reader);
+        REQUIRE(concat_chunks(moved) == "hello world");
+    }
+
+    SECTION("lines across chunk boundaries")
+    {
+        temp_file tmp("lines.txt", "alpha\nbeta\ngamma\ndelta");
+
+        std::vector<std::string> lines;
+        FLUX_FOR(auto line, flux::read_file_chunks(tmp.path, 4).chunk_records()) {
+            lines.emplace_back(line);
+        }
+
+        REQUIRE(lines == std::vector<std::string>{"alpha", "beta", "gamma", "delta"});
+    }
+
+    SECTION("missing file")
+    {
+        REQUIRE_THROWS_AS(flux::read_file_chunks("/this/file/does/not/exist"),
+                          std::system_error);
+    }
+}
@@ -0,0 +1,282 @@
+
+// Copyright (c) 2023 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "catch.hpp"
+
+#include <algorithm>
+#include <array>
+#include <deque>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "test_utils.hpp"
+
+#ifndef USE_MODULES
+#include <flux/source/deque.hpp>
+#endif
+
+namespace {
+
+// Collects the size of each segment
+constexpr auto segment_sizes(auto& seq) -> std::vector<flux::distance_t>
+{
+    std::vector<flux::distance_t> sizes;
+    flux::for_each_segment_while(seq, [&sizes](auto& segment) {
+        sizes.push_back(flux::size(segment));
+        return flux::size(segment);
+    });
+    return sizes;
+}
+
+constexpr bool test_flatten_segments()
+{
+    // flatten() over contiguous inner sequences is segmented
+    {
+        std::array<std::array<int, 3>, 2> arr{{{1, 2, 3}, {4, 5, 6}}};
+        auto seq = flux::ref(arr).flatten();
+
+        static_assert(flux::segmented_sequence<decltype(seq)>);
+
+        auto cur = flux::for_each_segment_while(seq, [](auto& segment) {
+            return flux::size(segment);
+        });
+        STATIC_CHECK(seq.is_last(cur));
+    }
+
+    // ...but not when they aren't contiguous
+    {
+        auto seq = flux::flatten(std::array{flux::iota(0, 3), flux::iota(3, 6)});
+        static_assert(not flux::segmented_sequence<decltype(seq)>);
+    }
+
+    // Stopping part-way through a segment gives a cursor to that element
+    {
+        std::array<std::array<int, 3>, 2> arr{{{1, 2, 3}, {4, 5, 6}}};
+        auto seq = flux::ref(arr).flatten();
+
+        auto cur = flux::for_each_segment_while(seq, [](auto& segment) {
+            return flux::size(segment) == 3 && segment[0] == 4
+                       ? flux::distance_t{1}
+                       : flux::size(segment);
+        });
+        STATIC_CHECK(seq[cur] == 5);
+    }
+
+    // Algorithms work segment by segment
+    {
+        std::array<std::array<int, 3>, 3> arr{{{1, 2, 3}, {2, 2, 4}, {5, 6, 2}}};
+        auto seq = flux::mut_ref(arr).flatten();
+
+        STATIC_CHECK(seq[seq.find(4)] == 4);
+        STATIC_CHECK(seq.is_last(seq.find(99)));
+        STATIC_CHECK(seq.count_eq(2) == 4);
+        STATIC_CHECK(seq.sum() == 27);
+        STATIC_CHECK(flux::equal(seq, std::array{1, 2, 3, 2, 2, 4, 5, 6, 2}));
+        STATIC_CHECK(flux::equal(std::array{1, 2, 3, 2, 2, 4, 5, 6, 2}, seq));
+        STATIC_CHECK(not flux::equal(seq, std::array{1, 2, 3, 2, 2, 4, 5, 6}));
+        STATIC_CHECK(not flux::equal(seq, std::array{1, 2, 3, 2, 2, 4, 5, 6, 2, 0}));
+        STATIC_CHECK(not flux::equal(std::array{1, 2, 3, 2, 9, 4, 5, 6, 2}, seq));
+
+        seq.fill(7);
+        STATIC_CHECK(seq.count_eq(7) == 9);
+    }
+
+#ifndef NO_CONSTEXPR_VECTOR
+    // Empty inner sequences are skipped over
+    {
+        std::vector<std::vector<int>> vec{{}, {1, 2}, {}, {}, {3}, {}};
+        auto seq = flux::ref(vec).flatten();
+
+        STATIC_CHECK(segment_sizes(seq) == std::vector<flux::distance_t>{0, 2, 0, 0, 1, 0});
+        STATIC_CHECK(seq[seq.find(3)] == 3);
+        STATIC_CHECK(seq.is_last(seq.find(0)));
+        STATIC_CHECK(flux::equal(seq, std::array{1, 2, 3}));
+        STATIC_CHECK(seq.sum() == 6);
+    }
+#endif
+
+    return true;
+}
+static_assert(test_flatten_segments());
+
+void test_deque()
+{
+    static_assert(flux::random_access_sequence<std::deque<int>>);
+    static_assert(flux::bounded_sequence<std::deque<int>>);
+    static_assert(flux::sized_sequence<std::deque<int>>);
+    static_assert(not flux::contiguous_sequence<std::deque<int>>);
+    static_assert(flux::random_access_sequence<std::deque<int> const>);
+
+    std::deque<int> deque;
+    for (int i = 0; i < 5000; i++) {
+        deque.push_back(i % 100);
+        deque.push_front(i % 100);
+    }
+
+    CHECK(flux::size(deque) == 10'000);
+    CHECK(flux::read_at(deque, 3) == deque[3]);
+    CHECK(flux::count_eq(deque, 7) == 100);
+    CHECK(flux::sum(deque) == 100 * 4950);
+    CHECK(flux::equal(deque, flux::from_range(deque)));
+    CHECK(deque[flux::find(deque, 42)] == 42);
+    CHECK(flux::find(deque, 100) == 10'000);
+    CHECK(flux::ref(deque).take(10).count_eq(99) == 1);
+
+    std::vector<int> vec(deque.begin(), deque.end());
+    CHECK(flux::equal(deque, vec));
+    CHECK(flux::equal(vec, deque));
+    vec[9000] = -1;
+    CHECK(not flux::equal(deque, vec));
+    CHECK(not flux::equal(vec, deque));
+
+    flux::sort(deque);
+    CHECK(std::is_sorted(deque.begin(), deque.end()));
+    CHECK(flux::count_eq(deque, 7) == 100);
+
+    flux::sort(deque, std::greater<>{});
+    CHECK(std::is_sorted(deque.begin(), deque.end(), std::greater<>{}));
+
+    flux::fill(deque, 3);
+    CHECK(flux::count_eq(deque, 3) == 10'000);
+
+    auto out = flux::to<std::vector<int>>(deque);
+    CHECK(out.size() == 10'000);
+    CHECK(flux::equal(out, deque));
+
+    static_assert(flux::segmented_sequence<std::deque<int>>);
+    static_assert(flux::segmented_sequence<std::deque<int> const>);
+    static_assert(flux::segmented_sequence<decltype(flux::ref(deque))>);
+    static_assert(flux::segmented_sequence<decltype(flux::from(std::deque<int>{}))>);
+
+    // Many blocks, none of them empty, containing all the elements
+    auto sizes = segment_sizes(deque);
+    CHECK(sizes.size() > 1);
+    CHECK(flux::count_eq(sizes, 0) == 0);
+    CHECK(flux::sum(sizes) == 10'000);
+
+    // Every segment is really contiguous, and they are visited in order
+    flux::distance_t offset = 0;
+    bool addresses_match = true;
+    flux::for_each_segment_while(deque, [&](auto& segment) {
+        for (flux::distance_t i = 0; i < flux::size(segment); i++) {
+            addresses_match = addresses_match &&
+                &segment[i] == &deque[static_cast<std::size_t>(offset + i)];
+        }
+        offset += flux::size(segment);
+        return flux::size(segment);
+    });
+    CHECK(addresses_match);
+    CHECK(offset == 10'000);
+
+    // Resuming part way through finds the right block boundaries
+    std::deque<int> iotas;
+    for (int i = 0; i < 3000; i++) {
+        iotas.push_back(i);
+    }
+    iotas.erase(iotas.begin(), iotas.begin() + 37);
+    int expected = 1000;
+    auto cur = flux::detail::for_each_while_from(iotas, flux::index_t{1000 - 37},
+                                                 [&expected](int i) { return i == expected++; });
+    CHECK(cur == flux::size(iotas));
+    CHECK(flux::sum(segment_sizes(iotas)) == 3000 - 37);
+
+    // Large elements may get a block each
+    std::deque<std::array<char, 1000>> big(10);
+    big[7][0] = 'x';
+    CHECK(flux::sum(segment_sizes(big)) == 10);
+    CHECK(flux::find_if(big, [](auto const& a) { return a[0] == 'x'; }) == 7);
+}
+
+void test_deque_sort_strings()
+{
+    std::deque<std::string> deque;
+    for (int i = 0; i < 1000; i++) {
+        deque.push_back(std::to_string((i * 7919) % 1000));
+    }
+
+    flux::sort(deque);
+
+    CHECK(std::is_sorted(deque.begin(), deque.end()));
+    CHECK(deque.front() == "0");
+    CHECK(deque.back() == "999");
+}
+
+// Leaves moved-from objects with a value of -1, and throws from the move
+// constructor once moves_left reaches zero
+struct throwing_move {
+    int value;
+
+    static inline int moves_left = -1;
+
+    explicit throwing_move(int v) : value(v) {}
+
+    throwing_move(throwing_move&& other) : value(other.value)
+    {
+        if (moves_left == 0) {
+            throw std::runtime_error("move");
+        }
+        --moves_left;
+        other.value = -1;
+    }
+
+    throwing_move& operator=(throwing_move&& other) noexcept
+    {
+        value = std::exchange(other.value, -1);
+        return *this;
+    }
+
+    friend auto operator<=>(throwing_move const&, throwing_move const&) = default;
+};
+
+void test_deque_sort_exceptions()
+{
+    std::deque<throwing_move> deque;
+    for (int i = 0; i < 1000; i++) {
+        deque.emplace_back((i * 7919) % 1000);
+    }
+
+    auto values = [&deque] {
+        std::vector<int> out;
+        for (auto const& elem : deque) {
+            out.push_back(elem.value);
+        }
+        return out;
+    };
+    auto const before = values();
+
+    // Throwing while moving elements into the buffer leaves them in place
+    throwing_move::moves_left = 600;
+    CHECK_THROWS_AS(flux::sort(deque), std::runtime_error);
+    CHECK(values() == before);
+
+    // Throwing while sorting leaves every element in the deque
+    throwing_move::moves_left = -1;
+    CHECK_THROWS_AS(flux::sort(deque, [](auto const& a, auto const& b) {
+        if (a.value == 500 || b.value == 500) {
+            throw std::runtime_error("compare");
+        }
+        return a < b;
+    }), std::runtime_error);
+    auto after = values();
+    std::sort(after.begin(), after.end());
+    auto sorted_before = before;
+    std::sort(sorted_before.begin(), sorted_before.end());
+    CHECK(after == sorted_before);
+}
+
+}
+
+TEST_CASE("segmented sequences")
+{
+    bool result = test_flatten_segments();
+    REQUIRE(result);
+
+    test_deque();
+    test_deque_sort_strings();
+    test_deque_sort_exceptions();
+}
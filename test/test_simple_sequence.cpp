@@ -5,6 +5,9 @@
 #include "catch.hpp"
 
 #include <array>
+#include <span>
+#include <string>
+#include <vector>
 
 #include "test_utils.hpp"
 
@@ -42,6 +45,39 @@ struct ints : flux::simple_sequence_base<ints> {
     }
 };
 
+// Yields [0, n), and counts how it was asked for elements. Bulk reads
+// return at most `max_block` elements, to check that short blocks work.
+struct bulk_ints : flux::simple_sequence_base<bulk_ints> {
+    int i = 0;
+    int n;
+    std::size_t max_block;
+    int single_calls = 0;
+    int bulk_calls = 0;
+
+    constexpr explicit bulk_ints(int n_, std::size_t max_block_ = 1000)
+        : n(n_), max_block(max_block_)
+    {}
+
+    constexpr auto maybe_next() -> std::optional<int>
+    {
+        ++single_calls;
+        if (i < n) {
+            return {i++};
+        }
+        return std::nullopt;
+    }
+
+    constexpr auto maybe_next_n(std::span<int> out) -> std::size_t
+    {
+        ++bulk_calls;
+        std::size_t count = 0;
+        while (count < out.size() && count < max_block && i < n) {
+            out[count++] = i++;
+        }
+        return count;
+    }
+};
+
 constexpr bool test_simple_sequence()
 {
     {
@@ -96,10 +132,102 @@ constexpr bool test_simple_sequence()
 }
 static_assert(test_simple_sequence());
 
+constexpr bool test_bulk_simple_sequence()
+{
+#ifndef USE_MODULES
+    static_assert(flux::detail::bulk_simple_sequence<bulk_ints>);
+    static_assert(not flux::detail::bulk_simple_sequence<ints>);
+#endif
+    static_assert(std::same_as<flux::element_t<bulk_ints>, int const&>);
+
+    // Internal iteration uses maybe_next_n()
+    {
+        auto seq = bulk_ints(1000);
+        STATIC_CHECK(flux::sum(seq) == 499'500);
+        STATIC_CHECK(seq.single_calls == 0);
+        STATIC_CHECK(seq.bulk_calls > 1);
+    }
+
+    // Short blocks are fine
+    {
+        auto seq = bulk_ints(10, 3);
+        STATIC_CHECK(check_equal(seq, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+    }
+
+    // Elements after the one where iteration stopped are not lost
+    {
+        auto seq = bulk_ints(600);
+        auto cur = flux::find(seq, 100);
+        STATIC_CHECK(seq.read_at(cur) == 100);
+
+        int expected = 100;
+        bool ok = true;
+        for (; !seq.is_last(cur); seq.inc(cur)) {
+            ok = ok && seq.read_at(cur) == expected++;
+        }
+        STATIC_CHECK(ok);
+        STATIC_CHECK(expected == 600);
+    }
+
+    // Elements are not lost if the cursor where iteration stopped is dropped
+    {
+        auto seq = bulk_ints(600);
+        STATIC_CHECK(seq.read_at(flux::find(seq, 10)) == 10);
+        STATIC_CHECK(seq.read_at(flux::find(seq, 20)) == 20);
+        STATIC_CHECK(seq.read_at(flux::find(seq, 300)) == 300);
+        STATIC_CHECK(flux::count(seq) == 299);
+    }
+
+    {
+        auto seq = bulk_ints(20, 8);
+        auto taken = flux::to<std::vector<int>>(
+            flux::take_while(flux::mut_ref(seq), flux::pred::lt(3)));
+        STATIC_CHECK(check_equal(taken, {0, 1, 2}));
+        STATIC_CHECK(flux::to<std::vector<int>>(seq).front() == 4);
+    }
+
+    // Restarting after stopping part way through a block
+    {
+        auto seq = bulk_ints(20, 8);
+        auto cur = flux::find(seq, 5);
+        auto rest = flux::slice(seq, std::move(cur), flux::last);
+        STATIC_CHECK(check_equal(rest, {5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19}));
+    }
+
+    // flux::to() fills contiguous containers in bulk
+    {
+        auto seq = bulk_ints(10'000, 100);
+        auto vec = flux::to<std::vector<int>>(seq);
+        STATIC_CHECK(vec.size() == 10'000);
+        STATIC_CHECK(vec.front() == 0);
+        STATIC_CHECK(vec.back() == 9999);
+        STATIC_CHECK(seq.single_calls == 0);
+    }
+
+    {
+        auto vec = flux::to<std::vector<int>>(bulk_ints(0));
+        STATIC_CHECK(vec.empty());
+    }
+
+    return true;
+}
+static_assert(test_bulk_simple_sequence());
+
 }
 
 TEST_CASE("simple_sequence")
 {
     bool result = test_simple_sequence();
     REQUIRE(result);
-}
\ No newline at end of file
+}
+
+TEST_CASE("simple_sequence with maybe_next_n")
+{
+    bool result = test_bulk_simple_sequence();
+    REQUIRE(result);
+
+    // Non-contiguous containers are filled using internal iteration
+    auto str = flux::to<std::string>(
+        flux::map(bulk_ints(5), [](int i) { return static_cast<char>('a' + i); }));
+    CHECK(str == "abcde");
+}
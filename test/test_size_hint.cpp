@@ -0,0 +1,151 @@
+
+// Copyright (c) 2023 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "catch.hpp"
+
+#include <array>
+#include <iterator>
+#include <string_view>
+#include <vector>
+
+#include "test_utils.hpp"
+
+namespace {
+
+constexpr auto bounds(flux::distance_t lower, flux::distance_t upper) -> flux::size_bounds
+{
+    return {lower, flux::optional<flux::distance_t>(upper)};
+}
+
+constexpr auto bounds(flux::distance_t lower) -> flux::size_bounds
+{
+    return {lower, flux::nullopt};
+}
+
+constexpr auto yes = [](auto&&) { return true; };
+
+// A multipass sequence which doesn't know its size
+constexpr auto unsized(auto& arr)
+{
+    return flux::ref(arr).filter(yes);
+}
+
+constexpr bool test_size_hint()
+{
+    // Sized sequences give exact bounds
+    {
+        std::array arr{1, 2, 3, 4, 5};
+        STATIC_CHECK(flux::size_hint(arr) == bounds(5, 5));
+        STATIC_CHECK(flux::ref(arr).map([](int i) { return i * 2; }).size_hint() == bounds(5, 5));
+    }
+
+    // Sequences with no hint have no upper bound
+    {
+        auto seq = flux::unfold([](int i) { return i + 1; }, 0);
+        STATIC_CHECK(flux::size_hint(seq) == bounds(0));
+        STATIC_CHECK(flux::take_while(seq, [](int i) { return i < 10; }).size_hint() == bounds(0));
+    }
+
+    // Filtering adaptors are bounded by their base
+    {
+        std::array arr{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+        STATIC_CHECK(unsized(arr).size_hint() == bounds(0, 10));
+        STATIC_CHECK(flux::ref(arr).take_while(yes).size_hint() == bounds(0, 10));
+        STATIC_CHECK(unsized(arr).drop_while(yes).size_hint() == bounds(0, 10));
+        STATIC_CHECK(flux::dedup(arr).size_hint() == bounds(1, 10));
+        STATIC_CHECK(flux::chunk_by(arr, std::less{}).size_hint() == bounds(1, 10));
+        STATIC_CHECK(flux::split(arr, 3).size_hint() == bounds(1, 11));
+        STATIC_CHECK(flux::lines(std::string_view("ab\ncd\n")).size_hint() == bounds(1, 6));
+        STATIC_CHECK(flux::lines(std::string_view()).size_hint() == bounds(0, 0));
+        STATIC_CHECK(unsized(arr).map([](int i) { return i; }).size_hint() == bounds(0, 10));
+    }
+
+    // Adaptors which change the length adjust their base's bounds
+    {
+        std::array arr{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+        STATIC_CHECK(unsized(arr).take(3).size_hint() == bounds(0, 3));
+        STATIC_CHECK(unsized(arr).take(30).size_hint() == bounds(0, 10));
+        STATIC_CHECK(unsized(arr).drop(3).size_hint() == bounds(0, 7));
+        STATIC_CHECK(unsized(arr).stride(3).size_hint() == bounds(0, 4));
+        STATIC_CHECK(unsized(arr).slide(3).size_hint() == bounds(0, 8));
+        STATIC_CHECK(unsized(arr).adjacent<3>().size_hint() == bounds(0, 8));
+        STATIC_CHECK(unsized(arr).cycle(3).size_hint() == bounds(0, 30));
+        STATIC_CHECK(unsized(arr).scan(std::plus{}).size_hint() == bounds(0, 10));
+        STATIC_CHECK(unsized(arr).prescan(std::plus{}, 0).size_hint() == bounds(1, 11));
+    }
+
+    // Multi-sequence adaptors combine their bases' bounds
+    {
+        std::array arr{1, 2, 3, 4, 5};
+        STATIC_CHECK(flux::chain(unsized(arr), arr).size_hint() == bounds(5, 10));
+        STATIC_CHECK(flux::zip(unsized(arr), flux::ref(arr).take(3)).size_hint() == bounds(0, 3));
+        STATIC_CHECK(flux::cartesian_product(unsized(arr), arr).size_hint() == bounds(0, 25));
+        STATIC_CHECK(flux::set_union(unsized(arr), arr).size_hint() == bounds(5, 10));
+        STATIC_CHECK(flux::set_intersection(unsized(arr), arr).size_hint() == bounds(0, 5));
+        STATIC_CHECK(flux::set_difference(unsized(arr), arr).size_hint() == bounds(0, 5));
+        STATIC_CHECK(flux::set_symmetric_difference(unsized(arr), arr).size_hint() == bounds(0, 10));
+        STATIC_CHECK(flux::chain(arr, flux::unfold(std::identity{}, 0)).size_hint() == bounds(5));
+    }
+
+    return true;
+}
+static_assert(test_size_hint());
+
+}
+
+TEST_CASE("size_hint")
+{
+    bool result = test_size_hint();
+    REQUIRE(result);
+
+    SECTION("to() reserves exactly when the bounds agree")
+    {
+        std::vector<int> ints(1000);
+        for (int i = 0; i < 1000; i++) {
+            ints[static_cast<std::size_t>(i)] = i;
+        }
+
+        auto most = flux::to<std::vector<int>>(
+            flux::ref(ints).filter([](int i) { return i % 10 != 0; }));
+        CHECK(most.size() == 900);
+
+        auto few = flux::to<std::vector<int>>(
+            flux::ref(ints).filter([](int i) { return i % 100 == 0; }));
+        CHECK(check_equal(few, {0, 100, 200, 300, 400, 500, 600, 700, 800, 900}));
+        CHECK(few.capacity() < 1000);
+
+        std::vector<std::vector<int>> vecs{{1, 2, 3}, {}, {4, 5}};
+        auto flat = flux::to<std::vector<int>>(flux::ref(vecs).flatten());
+        CHECK(flat.capacity() == 5);
+    }
+
+    SECTION("a sparse filter over a large base doesn't over-reserve")
+    {
+        auto is_three = [](int i) { return i == 3; };
+
+        std::vector<int> out;
+        flux::iota(0, 10'000'000).filter(is_three).output_to(std::back_inserter(out));
+        CHECK(check_equal(out, {3}));
+        CHECK(out.capacity() < 1000);
+
+        auto vec = flux::iota(0, 10'000'000).filter(is_three).to<std::vector<int>>();
+        CHECK(check_equal(vec, {3}));
+        CHECK(vec.capacity() < 1000);
+    }
+
+    SECTION("output_to() reserves for back_insert_iterators")
+    {
+        std::vector<int> ints{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+        std::vector<int> out;
+
+        flux::ref(ints).filter([](int i) { return i > 5; }).output_to(std::back_inserter(out));
+        CHECK(check_equal(out, {6, 7, 8, 9, 10}));
+
+        // take() of a sized base has exact bounds
+        std::vector<int> out2;
+        flux::ref(ints).take(7).output_to(std::back_inserter(out2));
+        CHECK(out2.capacity() == 7);
+    }
+}
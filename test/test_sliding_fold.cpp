@@ -0,0 +1,293 @@
+
+// Copyright (c) 2023 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "catch.hpp"
+
+#include <algorithm>
+#include <array>
+#include <numeric>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "test_utils.hpp"
+
+namespace {
+
+#ifndef NO_CONSTEXPR_VECTOR
+
+constexpr bool test_sliding_fold()
+{
+    // Basic sliding_fold
+    {
+        std::array arr{1, 5, 6, 1, 2, 9, 7, -1, 0};
+
+        auto seq = flux::sliding_fold(flux::ref(arr), 3, std::plus<>{}, std::minus<>{});
+
+        using S = decltype(seq);
+        static_assert(flux::sequence<S>);
+        static_assert(not flux::multipass_sequence<S>);
+        static_assert(flux::bounded_sequence<S>);
+        static_assert(flux::sized_sequence<S>);
+        static_assert(flux::read_only_sequence<S>);
+        static_assert(std::same_as<flux::element_t<S>, int const&>);
+
+        STATIC_CHECK(seq.size() == 7);
+        STATIC_CHECK(check_equal(seq, {12, 12, 9, 12, 18, 15, 6}));
+    }
+
+    // sliding_fold with a window size of one yields the elements
+    {
+        std::array arr{1, 2, 3};
+
+        auto seq = flux::ref(arr).sliding_fold(1, std::plus<>{}, std::minus<>{});
+
+        STATIC_CHECK(check_equal(seq, {1, 2, 3}));
+    }
+
+    // sliding_fold with a window larger than the sequence is empty
+    {
+        std::array arr{1, 2, 3};
+
+        auto seq = flux::ref(arr).sliding_fold(4, std::plus<>{}, std::minus<>{});
+
+        STATIC_CHECK(seq.size() == 0);
+        STATIC_CHECK(seq.is_empty());
+    }
+
+    // sliding_fold with an initial value of a different type
+    {
+        std::array arr{1, 2, 3, 4};
+
+        auto seq = flux::ref(arr).sliding_fold(2, std::plus<>{}, std::minus<>{}, 0.5);
+
+        static_assert(std::same_as<flux::element_t<decltype(seq)>, double const&>);
+        STATIC_CHECK(check_equal(seq, {3.5, 5.5, 7.5}));
+    }
+
+    // sliding_fold counting elements which satisfy a predicate
+    {
+        std::array arr{1, 2, 4, 6, 7, 9, 10};
+        auto is_even = [](int i) { return i % 2 == 0; };
+
+        auto seq = flux::ref(arr).sliding_fold(3,
+            [&](int n, int i) { return n + is_even(i); },
+            [&](int n, int i) { return n - is_even(i); },
+            0);
+
+        STATIC_CHECK(check_equal(seq, {2, 3, 2, 1, 1}));
+    }
+
+    // sliding_fold works with single-pass sequences
+    {
+        std::array arr{1, 2, 3, 4, 5};
+
+        auto seq = single_pass_only(flux::ref(arr))
+                       .sliding_fold(2, std::plus<>{}, std::minus<>{});
+
+        STATIC_CHECK(check_equal(seq, {3, 5, 7, 9}));
+    }
+
+    // sliding_fold with cursor stepping rather than internal iteration
+    {
+        std::array arr{1, 2, 3, 4, 5};
+
+        auto seq = flux::ref(arr).sliding_fold(2, std::plus<>{}, std::minus<>{});
+
+        std::array<int, 4> out{};
+        std::size_t i = 0;
+        for (auto cur = seq.first(); !seq.is_last(cur); seq.inc(cur)) {
+            out[i++] = seq[cur];
+        }
+
+        STATIC_CHECK(check_equal(out, {3, 5, 7, 9}));
+    }
+
+    // sliding_fold over an infinite sequence
+    {
+        auto seq = flux::ints(1).sliding_fold(3, std::plus<>{}, std::minus<>{});
+
+        static_assert(flux::infinite_sequence<decltype(seq)>);
+
+        STATIC_CHECK(check_equal(std::move(seq).take(4), {6, 9, 12, 15}));
+    }
+
+    // sliding_fold with non-trivial element types
+    {
+        std::array<std::string, 4> arr{"a", "bb", "ccc", "dddd"};
+
+        auto seq = flux::ref(arr).sliding_fold(2,
+            [](std::size_t n, std::string const& s) { return n + s.size(); },
+            [](std::size_t n, std::string const& s) { return n - s.size(); },
+            std::size_t{0});
+
+        STATIC_CHECK(check_equal(seq, {3u, 5u, 7u}));
+    }
+
+    // Iterating a second time starts with a fresh window
+    {
+        std::array arr{1, 2, 3, 4, 5};
+
+        auto seq = flux::sliding_fold(flux::ref(arr), 3, std::plus<>{}, std::minus<>{});
+
+        STATIC_CHECK(check_equal(seq.to<std::vector<int>>(), {6, 9, 12}));
+        STATIC_CHECK(check_equal(seq.to<std::vector<int>>(), {6, 9, 12}));
+
+        std::array<int, 3> out{};
+        std::size_t i = 0;
+        for (auto cur = seq.first(); !seq.is_last(cur); seq.inc(cur)) {
+            out[i++] = seq[cur];
+        }
+        STATIC_CHECK(check_equal(out, {6, 9, 12}));
+    }
+
+    return true;
+}
+static_assert(test_sliding_fold());
+
+constexpr bool test_sliding_min_max()
+{
+    // Basic sliding_min and sliding_max
+    {
+        std::array arr{1, 5, 6, 1, 2, 9, 7, -1, 0};
+
+        auto min = flux::sliding_min(flux::ref(arr), 3);
+
+        using S = decltype(min);
+        static_assert(flux::sequence<S>);
+        static_assert(not flux::multipass_sequence<S>);
+        static_assert(flux::bounded_sequence<S>);
+        static_assert(flux::sized_sequence<S>);
+        static_assert(flux::read_only_sequence<S>);
+
+        STATIC_CHECK(min.size() == 7);
+        STATIC_CHECK(check_equal(min, {1, 1, 1, 1, 2, -1, -1}));
+
+        auto max = flux::ref(arr).sliding_max(3);
+        STATIC_CHECK(check_equal(max, {6, 6, 6, 9, 9, 9, 7}));
+    }
+
+    // Window of size one
+    {
+        std::array arr{3, 1, 2};
+
+        STATIC_CHECK(check_equal(flux::ref(arr).sliding_min(1), {3, 1, 2}));
+        STATIC_CHECK(check_equal(flux::ref(arr).sliding_max(1), {3, 1, 2}));
+    }
+
+    // Window as large as the sequence
+    {
+        std::array arr{3, 1, 2};
+
+        STATIC_CHECK(check_equal(flux::ref(arr).sliding_min(3), {1}));
+        STATIC_CHECK(check_equal(flux::ref(arr).sliding_max(3), {3}));
+        STATIC_CHECK(flux::ref(arr).sliding_max(4).is_empty());
+    }
+
+    // Sorted and reverse-sorted input, with repeated elements
+    {
+        std::array up{1, 2, 2, 3, 4, 4, 5};
+        std::array down{5, 4, 4, 3, 2, 2, 1};
+
+        STATIC_CHECK(check_equal(flux::ref(up).sliding_min(3), {1, 2, 2, 3, 4}));
+        STATIC_CHECK(check_equal(flux::ref(up).sliding_max(3), {2, 3, 4, 4, 5}));
+        STATIC_CHECK(check_equal(flux::ref(down).sliding_min(3), {4, 3, 2, 2, 1}));
+        STATIC_CHECK(check_equal(flux::ref(down).sliding_max(3), {5, 4, 4, 3, 2}));
+    }
+
+    // Custom comparator
+    {
+        std::array arr{1, 5, 6, 1, 2, 9, 7, -1, 0};
+
+        auto seq = flux::ref(arr).sliding_min(3, std::ranges::greater{});
+
+        STATIC_CHECK(check_equal(seq, {6, 6, 6, 9, 9, 9, 7}));
+    }
+
+    // Single-pass sequences
+    {
+        std::array arr{4, 2, 3, 1};
+
+        auto seq = single_pass_only(flux::ref(arr)).sliding_max(2);
+
+        STATIC_CHECK(check_equal(seq, {4, 3, 3}));
+    }
+
+    // Iterating a second time starts with a fresh window
+    {
+        std::array arr{5, 1, 4, 2, 3};
+
+        auto seq = flux::sliding_min(flux::ref(arr), 2);
+
+        STATIC_CHECK(check_equal(seq.to<std::vector<int>>(), {1, 1, 2, 2}));
+        STATIC_CHECK(check_equal(seq.to<std::vector<int>>(), {1, 1, 2, 2}));
+
+        std::array<int, 4> out{};
+        std::size_t i = 0;
+        for (auto cur = seq.first(); !seq.is_last(cur); seq.inc(cur)) {
+            out[i++] = seq[cur];
+        }
+        STATIC_CHECK(check_equal(out, {1, 1, 2, 2}));
+    }
+
+    return true;
+}
+static_assert(test_sliding_min_max());
+
+#endif
+
+// Compares against recalculating each window from scratch
+void test_against_naive(int win_sz)
+{
+    std::mt19937 gen{static_cast<unsigned>(win_sz)};
+    std::uniform_int_distribution<int> dist(-50, 50);
+    std::vector<int> vec(2000);
+    for (auto& i : vec) {
+        i = dist(gen);
+    }
+
+    std::vector<int> mins, maxes, sums;
+    for (auto first = vec.begin(); vec.end() - first >= win_sz; ++first) {
+        auto const last = first + win_sz;
+        mins.push_back(*std::min_element(first, last));
+        maxes.push_back(*std::max_element(first, last));
+        sums.push_back(std::accumulate(first, last, 0));
+    }
+
+    CHECK(check_equal(flux::ref(vec).sliding_min(win_sz), mins));
+    CHECK(check_equal(flux::ref(vec).sliding_max(win_sz), maxes));
+    CHECK(check_equal(flux::ref(vec).sliding_fold(win_sz, std::plus<>{}, std::minus<>{}),
+                      sums));
+}
+
+}
+
+TEST_CASE("sliding_fold")
+{
+#ifndef NO_CONSTEXPR_VECTOR
+    bool res = test_sliding_fold();
+    REQUIRE(res);
+
+    res = test_sliding_min_max();
+    REQUIRE(res);
+#endif
+
+    SECTION("matches naive calculation")
+    {
+        for (int win_sz : {1, 2, 3, 10, 64, 1000}) {
+            test_against_naive(win_sz);
+        }
+    }
+
+    SECTION("works with istream sequences")
+    {
+        std::istringstream iss("3 1 4 1 5 9 2 6");
+
+        auto seq = flux::from_istream<int>(iss).sliding_min(3);
+
+        CHECK(check_equal(seq, {1, 1, 1, 1, 2, 2}));
+    }
+}
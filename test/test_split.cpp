@@ -7,8 +7,10 @@
 
 #include <array>
 #include <iostream>
+#include <sstream>
 #include <string>
 #include <string_view>
+#include <vector>
 
 #include "test_utils.hpp"
 
@@ -162,9 +164,51 @@ constexpr bool test_split_with_predicate()
     return true;
 }
 
+constexpr bool test_split_single_pass()
+{
+    using namespace std::string_view_literals;
+
+    // Split with delimiter
+    {
+        auto seq = flux::split(single_pass_only(flux::from("a,bb,,ccc,"sv)), ',');
+        using S = decltype(seq);
+
+        static_assert(flux::sequence<S>);
+        static_assert(not flux::multipass_sequence<S>);
+        static_assert(std::same_as<flux::element_t<S>, flux::array_ptr<char const>>);
+
+        STATIC_CHECK(check_equal(std::move(seq).map(to_string_view),
+                                 std::array{"a"sv, "bb"sv, ""sv, "ccc"sv, ""sv}));
+    }
+
+    // Split with predicate, using the member function
+    {
+        auto seq = single_pass_only(flux::from(std::array{1, 2, 0, 3, -1, 4, 5}))
+                       .split([](int i) { return i <= 0; });
+
+        auto sums = std::move(seq).map([](auto arr) { return flux::sum(arr); });
+        STATIC_CHECK(check_equal(sums, std::array{3, 3, 9}));
+    }
+
+    // Empty input has no fields, like the multipass version
+    {
+        auto seq = flux::split(single_pass_only(flux::from(""sv)), ',');
+        STATIC_CHECK(seq.is_last(seq.first()));
+    }
+
+    // No delimiters gives a single field
+    {
+        auto seq = flux::split_string(single_pass_only(flux::from("abc"sv)), ',');
+        STATIC_CHECK(check_equal(seq, std::array{"abc"sv}));
+    }
+
+    return true;
+}
+
 static_assert(test_split_with_delim());
 static_assert(test_split_with_pattern());
 static_assert(test_split_with_predicate());
+static_assert(test_split_single_pass());
 
 }
 
@@ -185,3 +229,31 @@ TEST_CASE("split with predicate")
     bool result = test_split_with_predicate();
     REQUIRE(result);
 }
+
+TEST_CASE("split single-pass")
+{
+    bool result = test_split_single_pass();
+    REQUIRE(result);
+
+    SECTION("streaming split_string over an istreambuf")
+    {
+        using namespace std::string_view_literals;
+
+        std::istringstream iss("name,age\nalice,30\nbob,4");
+
+        auto seq = flux::from_istreambuf(iss).split_string('\n');
+        REQUIRE(check_equal(seq, std::array{"name,age"sv, "alice,30"sv, "bob,4"sv}));
+    }
+
+    SECTION("fields longer than the streambuf's buffer")
+    {
+        std::string const long_field(100'000, 'x');
+        std::istringstream iss(long_field + ";" + long_field + "y");
+
+        std::vector<std::size_t> sizes;
+        FLUX_FOR(auto field, flux::from_istreambuf(iss).split(';')) {
+            sizes.push_back(field.size());
+        }
+        REQUIRE(sizes == std::vector<std::size_t>{100'000, 100'001});
+    }
+}
@@ -140,6 +140,59 @@ constexpr bool test_stride_non_bidir()
         STATIC_CHECK(&seq[cur] == arr.data() + 4);
     }
 
+    // Internal iteration doesn't read the elements which are stepped over
+    {
+        std::array arr{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+        int calls = 0;
+
+        auto seq = NotBidir(flux::ref(arr).map([&calls](int i) { ++calls; return i; }))
+                       .stride(3);
+
+        STATIC_CHECK(seq.sum() == 0 + 3 + 6 + 9);
+        STATIC_CHECK(calls == 4);
+    }
+
+    // ...including through take(), which doesn't read past its end
+    {
+        std::array arr{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+        int calls = 0;
+
+        auto seq = NotBidir(flux::ref(arr).map([&calls](int i) { ++calls; return i; }))
+                       .take(7)
+                       .stride(3);
+
+        STATIC_CHECK(seq.sum() == 0 + 3 + 6);
+        STATIC_CHECK(calls == 3);
+
+        calls = 0;
+        auto cur = seq.find(100);
+        STATIC_CHECK(seq.is_last(cur));
+        STATIC_CHECK(calls == 3);
+    }
+
+    // ...and through slide(), whose windows don't read the base
+    {
+        std::array arr{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+        int calls = 0;
+
+        auto seq = NotBidir(flux::ref(arr).map([&calls](int i) { ++calls; return i; }))
+                       .slide(3)
+                       .stride(3);
+
+        STATIC_CHECK(seq.count() == 3);
+        STATIC_CHECK(calls == 0);
+    }
+
+    // Internal iteration starts after the elements dropped by drop_while()
+    {
+        std::array arr{1, 2, 3, 4, 5, 6, 7, 8};
+
+        auto seq = NotBidir(flux::ref(arr)).drop_while([](int i) { return i < 5; }).stride(2);
+
+        STATIC_CHECK(check_equal(seq, {5, 7}));
+        STATIC_CHECK(seq.sum() == 5 + 7);
+    }
+
     return true;
 }
 static_assert(test_stride_non_bidir());
@@ -337,6 +390,67 @@ constexpr bool test_stride_bidir()
         STATIC_CHECK(check_equal(arr, {3, 8, 7, 6, 5, 4, 9, 2, 1}));
     }
 
+    // Internal iteration doesn't read the elements which are stepped over
+    {
+        std::array arr{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+        int calls = 0;
+
+        auto seq = flux::ref(arr).map([&calls](int i) { ++calls; return i; }).stride(4);
+
+        STATIC_CHECK(seq.sum() == 0 + 4 + 8);
+        STATIC_CHECK(calls == 3);
+
+        auto cur = seq.find(100);
+        STATIC_CHECK(cur == seq.last());
+        STATIC_CHECK(seq.distance(seq.first(), cur) == 3);
+    }
+
+    // ...including across the segments of chain() and flatten()
+    {
+        std::array arr1{0, 1, 2, 3, 4};
+        std::array arr2{5, 6, 7, 8, 9, 10, 11};
+        int calls = 0;
+        auto count_calls = [&calls](int i) { ++calls; return i; };
+
+        auto chained = flux::chain(flux::ref(arr1).map(count_calls),
+                                   flux::ref(arr2).map(count_calls)).stride(3);
+
+        STATIC_CHECK(chained.sum() == 0 + 3 + 6 + 9);
+        STATIC_CHECK(calls == 4);
+
+        std::array<std::array<int, 3>, 4> nested{{{0, 1, 2}, {3, 4, 5}, {6, 7, 8}, {9, 10, 11}}};
+        calls = 0;
+
+        auto flattened = flux::ref(nested).flatten().map(count_calls).stride(5);
+
+        STATIC_CHECK(flattened.sum() == 0 + 5 + 10);
+        STATIC_CHECK(calls == 3);
+    }
+
+    // filter() needs to read every element, but only passes on every nth
+    {
+        std::array arr{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+        int calls = 0;
+
+        auto seq = flux::ref(arr)
+                       .filter([](int i) { return i % 2 == 0; })
+                       .map([&calls](int i) { ++calls; return i; })
+                       .stride(2);
+
+        STATIC_CHECK(seq.sum() == 0 + 4 + 8);
+        STATIC_CHECK(calls == 3);
+    }
+
+    // Internal iteration starts after the elements dropped by drop_while()
+    {
+        std::array arr{1, 2, 3, 4, 5, 6, 7, 8};
+
+        auto seq = flux::ref(arr).drop_while([](int i) { return i < 5; }).stride(2);
+
+        STATIC_CHECK(check_equal(seq, {5, 7}));
+        STATIC_CHECK(seq.sum() == 5 + 7);
+    }
+
     return true;
 }
 static_assert(test_stride_bidir());
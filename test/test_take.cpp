@@ -22,6 +22,38 @@ struct Tester : flux::simple_sequence_base<Tester> {
     }
 };
 
+// Yields [0, n), and counts calls to its for_each_while(). It has no
+// for_each_while_from().
+struct internal_counter : flux::inline_sequence_base<internal_counter> {
+    int n;
+    int internal_calls = 0;
+
+    constexpr explicit internal_counter(int n_) : n(n_) {}
+
+    struct flux_sequence_traits {
+        static constexpr auto first(internal_counter&) -> int { return 0; }
+
+        static constexpr auto is_last(internal_counter& self, int cur) -> bool
+        {
+            return cur >= self.n;
+        }
+
+        static constexpr auto inc(internal_counter&, int& cur) -> void { ++cur; }
+
+        static constexpr auto read_at(internal_counter&, int cur) -> int { return cur; }
+
+        static constexpr auto for_each_while(internal_counter& self, auto&& pred) -> int
+        {
+            ++self.internal_calls;
+            int cur = 0;
+            while (cur < self.n && std::invoke(pred, cur)) {
+                ++cur;
+            }
+            return cur;
+        }
+    };
+};
+
 constexpr bool test_take()
 {
     {
@@ -125,6 +157,22 @@ constexpr bool test_take()
         STATIC_CHECK(cur.length == 0);
     }
 
+    // for_each_while uses the base's own internal iteration
+    {
+        auto base = internal_counter(10);
+        auto taken = flux::mut_ref(base).take(4);
+
+        STATIC_CHECK(taken.sum() == 6);
+        STATIC_CHECK(base.internal_calls == 1);
+
+        auto cur = taken.find(99);
+        STATIC_CHECK(taken.is_last(cur));
+        STATIC_CHECK(cur.base_cur == 4);
+        STATIC_CHECK(base.internal_calls == 2);
+
+        STATIC_CHECK(taken[taken.find(2)] == 2);
+    }
+
     return true;
 }
 static_assert(test_take());
@@ -9,14 +9,37 @@
 #include <array>
 #include <list>
 #include <map>
+#include <memory_resource>
 #include <set>
 #include <sstream>
+#include <string>
 #include <vector>
 
 #include "test_utils.hpp"
 
 namespace {
 
+struct counting_resource : std::pmr::memory_resource {
+    int allocations = 0;
+
+private:
+    void* do_allocate(std::size_t bytes, std::size_t align) override
+    {
+        ++allocations;
+        return std::pmr::new_delete_resource()->allocate(bytes, align);
+    }
+
+    void do_deallocate(void* ptr, std::size_t bytes, std::size_t align) override
+    {
+        std::pmr::new_delete_resource()->deallocate(ptr, bytes, align);
+    }
+
+    bool do_is_equal(std::pmr::memory_resource const& other) const noexcept override
+    {
+        return this == &other;
+    }
+};
+
 template <typename T>
 struct my_allocator {
     using value_type = T;
@@ -211,6 +234,41 @@ TEST_CASE("to")
             CHECK(check_equal(vec, {"The", "quick", "brown", "fox"}));
         }
 
+        SECTION("recursive to() calls propagate allocators to inner containers")
+        {
+            counting_resource upstream;
+            flux::arena arena(64 * 1024, &upstream);
+
+            using Inner = std::pmr::vector<int>;
+            std::vector<std::vector<int>> groups;
+            for (int i = 0; i < 100'000; i++) {
+                groups.push_back({i, i + 1, i + 2});
+            }
+
+            auto vec = flux::to<std::pmr::vector<Inner>>(groups, &arena);
+
+            REQUIRE(vec.size() == 100'000);
+            CHECK(check_equal(vec[0], {0, 1, 2}));
+            CHECK(check_equal(vec.back(), {99'999, 100'000, 100'001}));
+            CHECK(vec.get_allocator().resource() == &arena);
+            CHECK(vec[100].get_allocator().resource() == &arena);
+
+            // A handful of big blocks, rather than one allocation per group
+            CHECK(upstream.allocations < 20);
+        }
+
+        SECTION("recursive to() calls with an arena allocator")
+        {
+            flux::arena arena;
+
+            std::string const str = "The quick brown fox";
+            auto vec = flux::split(flux::ref(str), ' ')
+                           .to<std::pmr::vector<std::pmr::string>>(arena.allocator());
+
+            CHECK(check_equal(vec, {"The", "quick", "brown", "fox"}));
+            CHECK(vec[1].get_allocator().resource() == &arena);
+        }
+
         SECTION("from set_union adaptor")
         {
             auto union_seq = flux::set_union(std::array{1,2,3}, std::array{4,5});
@@ -218,6 +276,42 @@ TEST_CASE("to")
 
             CHECK(check_equal(vec, {1,2,3,4,5}));
         }
+
+        SECTION("rvalue map over an owned vector reuses its buffer")
+        {
+            std::vector<int> vec1{1, 2, 3, 4, 5};
+            auto const* data = vec1.data();
+
+            auto vec2 = flux::from(std::move(vec1))
+                            .map([](int i) { return i * 10; })
+                            .to<std::vector<int>>();
+
+            CHECK(vec2.data() == data);
+            CHECK(check_equal(vec2, {10, 20, 30, 40, 50}));
+        }
+
+        SECTION("lvalue map does not steal its underlying vector")
+        {
+            std::vector<int> vec1{1, 2, 3, 4, 5};
+
+            auto seq = flux::map(flux::ref(vec1), [](int i) { return i * 10; });
+            auto vec2 = std::move(seq).to<std::vector<int>>();
+
+            CHECK(vec2.data() != vec1.data());
+            CHECK(check_equal(vec1, {1, 2, 3, 4, 5}));
+            CHECK(check_equal(vec2, {10, 20, 30, 40, 50}));
+        }
+
+        SECTION("map which changes the value type allocates a new vector")
+        {
+            std::vector<int> vec1{1, 2, 3};
+
+            auto vec2 = flux::from(std::move(vec1))
+                            .map([](int i) { return static_cast<double>(i) / 2; })
+                            .to<std::vector<double>>();
+
+            CHECK(check_equal(vec2, {0.5, 1.0, 1.5}));
+        }
     }
 
     SECTION("...using CTAD")
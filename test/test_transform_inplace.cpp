@@ -0,0 +1,89 @@
+
+// Copyright (c) 2023 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "catch.hpp"
+
+#include <array>
+#include <string>
+#include <vector>
+
+#include "test_utils.hpp"
+
+namespace {
+
+constexpr bool test_transform_inplace()
+{
+    // Basic transform_inplace()
+    {
+        std::array arr{1, 2, 3, 4, 5};
+
+        flux::transform_inplace(arr, [](int i) { return i * i; });
+
+        STATIC_CHECK(check_equal(arr, {1, 4, 9, 16, 25}));
+    }
+
+    // transform_inplace on an adapted sequence
+    {
+        std::array arr{1, 2, 3, 4, 5};
+
+        flux::take(flux::mut_ref(arr), 3).transform_inplace([](int i) { return -i; });
+
+        STATIC_CHECK(check_equal(arr, {-1, -2, -3, 4, 5}));
+    }
+
+    // single-pass sequences can be transformed
+    {
+        std::array arr{1, 2, 3};
+
+        single_pass_only(flux::mut_ref(arr)).transform_inplace([](int i) { return i + 1; });
+
+        STATIC_CHECK(check_equal(arr, {2, 3, 4}));
+    }
+
+    // The function may return a different type, if it's assignable
+    {
+        std::array<long, 3> arr{1, 2, 3};
+
+        flux::transform_inplace(arr, [](long l) { return static_cast<int>(l * 2); });
+
+        STATIC_CHECK(check_equal(arr, {2L, 4L, 6L}));
+    }
+
+    // Empty sequences can be transformed
+    {
+        auto e = flux::empty<int>;
+        flux::transform_inplace(e, [](int) -> int { return 0; });
+    }
+
+    // Read-only sequences cannot be transformed
+    {
+        std::array arr{1, 2, 3};
+        auto id = [](int i) { return i; };
+        static_assert(!std::invocable<decltype(flux::transform_inplace),
+                                      decltype(flux::ref(arr)), decltype(id)>);
+    }
+
+#ifndef NO_CONSTEXPR_VECTOR
+    // Works with non-trivial element types
+    {
+        std::vector<std::string> vec{"a", "b", "c"};
+
+        flux::transform_inplace(vec, [](std::string s) { return s + s; });
+
+        STATIC_CHECK(check_equal(vec, {"aa", "bb", "cc"}));
+    }
+#endif
+
+    return true;
+}
+static_assert(test_transform_inplace());
+
+}
+
+TEST_CASE("transform_inplace")
+{
+    bool result = test_transform_inplace();
+    REQUIRE(result);
+}
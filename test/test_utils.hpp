@@ -7,6 +7,15 @@
 
 #pragma once
 
+#include <cctype>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+#include <catch2/interfaces/catch_interfaces_capture.hpp>
+
 #ifndef USE_MODULES
 #include <flux.hpp>
 #else
@@ -124,6 +133,43 @@ struct flux::sequence_traits<single_pass_only<Base>>
     }
 };
 
+// A file in the temporary directory with the given contents, which is removed
+// when it goes out of scope. The file name includes the name of the running
+// test case, so that test cases which ctest runs in parallel don't collide.
+struct temp_file {
+    std::filesystem::path path;
+
+    explicit temp_file(std::string_view name, std::string_view contents = {})
+        : path(std::filesystem::temp_directory_path() / unique_name(name))
+    {
+        std::ofstream out(path, std::ios::binary);
+        out.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+    }
+
+    temp_file(temp_file const&) = delete;
+    temp_file& operator=(temp_file const&) = delete;
+
+    ~temp_file()
+    {
+        std::error_code ec;
+        std::filesystem::remove(path, ec);
+    }
+
+private:
+    static auto unique_name(std::string_view name) -> std::string
+    {
+        std::string out = "flux_test_" + Catch::getResultCapture().getCurrentTestName();
+        for (char& c : out) {
+            if (!std::isalnum(static_cast<unsigned char>(c))) {
+                c = '_';
+            }
+        }
+        out += '_';
+        out += name;
+        return out;
+    }
+};
+
 template <typename Reqd, typename Expr>
 constexpr void assert_has_type(Expr&&)
 {
@@ -0,0 +1,159 @@
+// Copyright (c) 2023 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "catch.hpp"
+
+#include <bit>
+#include <cstdint>
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include "test_utils.hpp"
+
+#ifndef USE_MODULES
+#include <flux/source/mmap_file.hpp>
+#endif
+
+namespace {
+
+struct point {
+    double x;
+    double y;
+
+    friend bool operator==(point const&, point const&) = default;
+};
+
+auto read_all(std::FILE* file) -> std::string
+{
+    std::string out;
+    char buf[4096];
+    std::rewind(file);
+    while (auto n = std::fread(buf, 1, sizeof(buf), file)) {
+        out.append(buf, n);
+    }
+    return out;
+}
+
+}
+
+TEST_CASE("write_binary")
+{
+    SECTION("contiguous round trip through an ostream")
+    {
+        std::vector<point> const points{{1.0, 2.0}, {3.0, 4.0}, {-5.5, 6.25}};
+
+        std::ostringstream oss;
+        flux::write_binary(points, oss);
+        std::string const bytes = oss.str();
+
+        REQUIRE(bytes.size() == points.size() * sizeof(point));
+        REQUIRE(check_equal(flux::read_binary<point>(flux::ref(bytes)), points));
+    }
+
+    SECTION("non-contiguous sequences are buffered")
+    {
+        auto seq = flux::iota(0, 100'000).map([](int i) { return std::int64_t{i} * 3; });
+
+        std::ostringstream oss;
+        flux::write_binary(seq, oss);
+        std::string const bytes = oss.str();
+
+        auto back = flux::read_binary<std::int64_t>(flux::ref(bytes));
+        REQUIRE(back.size() == 100'000);
+        REQUIRE(check_equal(back, seq));
+    }
+
+    SECTION("writing with a given byte order")
+    {
+        std::vector<std::uint32_t> const vals{0x01020304, 0xA0B0C0D0};
+
+        std::ostringstream oss;
+        flux::write_binary(vals, oss, std::endian::big);
+        std::string const bytes = oss.str();
+
+        REQUIRE(bytes == std::string("\x01\x02\x03\x04\xA0\xB0\xC0\xD0", 8));
+        REQUIRE(check_equal(flux::read_binary<std::uint32_t>(flux::ref(bytes), std::endian::big),
+                            vals));
+    }
+
+    SECTION("ostream failures are reported")
+    {
+        std::vector<int> const vals{1, 2, 3};
+        auto seq = flux::ref(vals).map([](int i) { return i * 2; });
+
+        // A stream with no buffer fails every write
+        std::ostream bad(nullptr);
+        REQUIRE_THROWS_AS(flux::write_binary(vals, bad), std::system_error);
+
+        bad.clear();
+        REQUIRE_THROWS_AS(flux::write_binary(seq, bad), std::system_error);
+
+        // As does one which has already failed
+        std::ostringstream oss;
+        oss.setstate(std::ios_base::failbit);
+        REQUIRE_THROWS_AS(flux::write_binary(vals, oss), std::system_error);
+    }
+
+    SECTION("writing to a FILE*")
+    {
+        std::FILE* file = std::tmpfile();
+        REQUIRE(file != nullptr);
+
+        std::vector<float> const vals{1.0f, 2.0f, 3.0f};
+        flux::write_binary(flux::ref(vals).reverse(), file);
+        std::string const bytes = read_all(file);
+        std::fclose(file);
+
+        REQUIRE(check_equal(flux::read_binary<float>(flux::ref(bytes)),
+                            std::vector<float>{3.0f, 2.0f, 1.0f}));
+    }
+
+#if FLUX_HAVE_FD_WRITE_TO
+    SECTION("writing to a file descriptor")
+    {
+        std::FILE* file = std::tmpfile();
+        REQUIRE(file != nullptr);
+
+        std::vector<std::int16_t> vals(50'000);
+        for (std::size_t i = 0; i < vals.size(); ++i) {
+            vals[i] = static_cast<std::int16_t>(i);
+        }
+        int const fd = ::fileno(file);
+        flux::write_binary(vals, fd, std::endian::little);
+        std::string const bytes = read_all(file);
+        std::fclose(file);
+
+        REQUIRE(check_equal(flux::read_binary<std::int16_t>(flux::ref(bytes),
+                                                            std::endian::little),
+                            vals));
+
+        // Const handles can be used too
+        std::FILE* const file2 = std::tmpfile();
+        REQUIRE(file2 != nullptr);
+        flux::write_binary(vals, file2);
+        REQUIRE(read_all(file2) == bytes);
+        std::fclose(file2);
+    }
+#endif
+
+#if FLUX_HAVE_MMAP_FILE
+    SECTION("reading back through mmap_file")
+    {
+        temp_file tmp("points.bin");
+        std::vector<point> const points{{0.5, 1.5}, {2.5, 3.5}};
+        {
+            std::FILE* file = std::fopen(tmp.path.string().c_str(), "wb");
+            REQUIRE(file != nullptr);
+            flux::write_binary(points, file);
+            std::fclose(file);
+        }
+
+        flux::mmap_file file(tmp.path);
+        REQUIRE(check_equal(flux::read_binary<point>(flux::ref(file)), points));
+    }
+#endif
+}
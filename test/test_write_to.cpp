@@ -5,7 +5,12 @@
 
 #include "catch.hpp"
 
+#include <array>
+#include <cstdio>
+#include <iterator>
 #include <sstream>
+#include <string>
+#include <string_view>
 #include <vector>
 
 #ifdef USE_MODULES
@@ -51,4 +56,148 @@ TEST_CASE("write to")
 
         REQUIRE(oss.str() == "[1, 2, 3, 4, 5]\n");
     }
-}
\ No newline at end of file
+
+    SECTION("format_to uses the same default format")
+    {
+        std::vector<std::vector<int>> vec{{1, -2}, {}, {300}};
+
+        std::string out;
+        flux::format_to(vec, std::back_inserter(out));
+
+        REQUIRE(out == "[[1, -2], [], [300]]");
+    }
+
+    SECTION("format_to with custom options")
+    {
+        std::vector<std::vector<double>> vec{{0.5, 1.0}, {-2.25}};
+
+        std::string out;
+        flux::format_to(vec, std::back_inserter(out),
+                        {.open = "", .close = "\n", .separator = " "});
+
+        REQUIRE(out == "0.5 1\n -2.25\n\n");
+    }
+
+    SECTION("format_to with strings, chars and bools")
+    {
+        std::vector<std::string_view> words{"hello", "world"};
+        std::string chars = "abc";
+        bool bools[] = {true, false};
+
+        std::string out;
+        flux::format_to(words, std::back_inserter(out));
+        flux::format_to(chars, std::back_inserter(out), {.separator = ""});
+        flux::format_to(bools, std::back_inserter(out));
+
+        REQUIRE(out == "[[h, e, l, l, o], [w, o, r, l, d]][abc][1, 0]");
+
+        out.clear();
+        flux::format_to(words, std::back_inserter(out),
+                        {.open = "", .close = "\n", .separator = ""});
+        REQUIRE(out == "hello\nworld\n\n");
+    }
+
+    SECTION("all overloads give the same output")
+    {
+        auto check_same = [](auto const& seq) {
+            std::ostringstream oss;
+            flux::write_to(seq, oss);
+
+            std::string formatted;
+            flux::format_to(seq, std::back_inserter(formatted));
+            REQUIRE(formatted == oss.str());
+
+            auto read_back = [](std::FILE* file) {
+                std::string str;
+                std::rewind(file);
+                int c;
+                while ((c = std::fgetc(file)) != EOF) {
+                    str.push_back(static_cast<char>(c));
+                }
+                std::fclose(file);
+                return str;
+            };
+
+            std::FILE* file = std::tmpfile();
+            REQUIRE(file != nullptr);
+            flux::write_to(seq, file);
+            REQUIRE(read_back(file) == oss.str());
+
+#if FLUX_HAVE_FD_WRITE_TO
+            file = std::tmpfile();
+            REQUIRE(file != nullptr);
+            flux::write_to(seq, ::fileno(file));
+            REQUIRE(read_back(file) == oss.str());
+#endif
+        };
+
+        check_same(std::vector<std::string>{"ab", "c", ""});
+        check_same(std::vector<std::string_view>{"x", "yz"});
+        check_same(std::vector<std::vector<std::string>>{{"ab"}, {}, {"c", "d"}});
+        check_same(std::string("hello"));
+        check_same(std::vector<char>{'a', 'b'});
+        check_same(std::vector<signed char>{'a', 'b'});
+        check_same(std::vector<unsigned char>{'a', 'b'});
+        check_same(std::array{true, false});
+        check_same(std::vector<double>{0.1 + 0.2, 1e100, -0.0, 1234567.0});
+        check_same(std::vector<std::vector<int>>{{1, -2}, {}, {300}});
+        check_same(std::vector<char const*>{"abc", "d"});
+    }
+
+    SECTION("format_to with output larger than the internal buffer")
+    {
+        auto seq = flux::iota(0, 100'000);
+
+        std::string out;
+        flux::format_to(seq, std::back_inserter(out), {.open = "", .close = "", .separator = "\n"});
+
+        std::ostringstream oss;
+        for (int i = 0; i < 100'000; ++i) {
+            oss << i << (i < 99'999 ? "\n" : "");
+        }
+
+        REQUIRE(out == oss.str());
+    }
+
+    SECTION("write_to FILE*")
+    {
+        std::FILE* file = std::tmpfile();
+        REQUIRE(file != nullptr);
+
+        std::string big(100'000, 'x');
+        std::vector<std::string> vec{"a", big, "b"};
+
+        flux::write_to(vec, file, {.open = "", .close = "\n", .separator = ""});
+
+        std::string expected = "a\n" + big + "\nb\n\n";
+        std::string actual(expected.size() + 1, '\0');
+        std::rewind(file);
+        auto n = std::fread(actual.data(), 1, actual.size(), file);
+        std::fclose(file);
+        actual.resize(n);
+
+        REQUIRE(actual == expected);
+    }
+
+#if FLUX_HAVE_FD_WRITE_TO
+    SECTION("write_to file descriptor")
+    {
+        std::FILE* file = std::tmpfile();
+        REQUIRE(file != nullptr);
+
+        std::string big(100'000, 'y');
+        std::vector<std::string_view> vec{"a", big, "b"};
+
+        flux::write_to(vec, ::fileno(file), {.open = "<", .close = ">", .separator = ""});
+
+        std::string expected = "<<a><" + big + "><b>>";
+        std::string actual(expected.size() + 1, '\0');
+        std::rewind(file);
+        auto n = std::fread(actual.data(), 1, actual.size(), file);
+        std::fclose(file);
+        actual.resize(n);
+
+        REQUIRE(actual == expected);
+    }
+#endif
+}